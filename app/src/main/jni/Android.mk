@@ -25,10 +25,10 @@ LOCAL_PATH := ${MY_LOCAL_PATH}
 include $(CLEAR_VARS)
 
 LOCAL_MODULE           := app
-LOCAL_SRC_FILES        := Android_Java_interop.cpp exampleBasic.cpp exampleAdvanced.cpp
+LOCAL_SRC_FILES        := Android_Java_interop.cpp exampleBasic.cpp exampleAdvanced.cpp engineSetup.cpp parallelProcessing.cpp presetPreview.cpp moduleChainUtilities.cpp processorSwitching.cpp heapHooks.cpp parameterAutomation.cpp sampleFormats.cpp silenceGate.cpp processorPool.cpp compiledPreset.cpp presetBank.cpp featureExtraction.cpp
 LOCAL_C_INCLUDES       += $(LE_SDK_PATH)/include
-LOCAL_CFLAGS           += -std=c++14 -fno-rtti -Wall -Wno-non-template-friend -Wno-unused-local-typedefs -Wno-unknown-warning-option -Wno-multichar
-LOCAL_LDLAGS           += --gc-sections --icf=all
+LOCAL_CFLAGS           += -std=c++14 -fno-rtti -Wall -Wno-non-template-friend -Wno-unused-local-typedefs -Wno-unknown-warning-option -Wno-multichar -ffunction-sections -fdata-sections
+LOCAL_LDFLAGS          += -Wl,--gc-sections -Wl,--icf=all -fuse-ld=gold
 LOCAL_STATIC_LIBRARIES := le_soundeffects_sdk le_audioio_sdk le_utility
 
 include $(BUILD_SHARED_LIBRARY)
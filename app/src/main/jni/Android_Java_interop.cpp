@@ -9,8 +9,13 @@
 ///
 ////////////////////////////////////////////////////////////////////////////////
 //------------------------------------------------------------------------------
+#include "compiledPreset.hpp"
 #include "exampleBasic.hpp"
 #include "exampleAdvanced.hpp"
+#include "heapHooks.hpp"
+#include "moduleChainUtilities.hpp"
+#include "parameterAutomation.hpp"
+#include "silenceGate.hpp"
 
 #include <le/parameters/runtimeInformation.hpp>
 
@@ -40,6 +45,7 @@ jmethodID                        addParameterWidget;
 
 ExampleFileRenderer      fileRenderer      ;
 ExampleLiveInputRenderer microphoneRenderer;
+SilenceGate              microphoneGate    ;
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -92,6 +98,13 @@ void JNICALL Java_demo_littleendiandemo_app_LESoundEffectsExampleActivity_render
 {
     auto presetName = Utility::JNI::c_str( *pEnv, javaPresetName );
 
+#ifndef NDEBUG
+    // Debug builds check every bundled preset that gets used against its
+    // compiled form (see compiledPreset.hpp).
+    if ( !verifyCompiledPreset<Utility::Resources>( presetName.get() ) )
+        Utility::Tracer::error( "Preset %s does not survive compilation.", presetName.get() );
+#endif // NDEBUG
+
     // We might use the ExampleLiveInputRenderer class from
     // exampleBasic.hpp, similarly to how ExampleFileRenderer was used
     // in renderPresetWithFileRealtime(), to process and playback microphone
@@ -112,7 +125,11 @@ void JNICALL Java_demo_littleendiandemo_app_LESoundEffectsExampleActivity_render
 
     processor.setAudioFormat                ( 1, 44100         ); // errchk
     processor.loadPreset<Utility::Resources>( presetName.get() ); // errchk
+    removeInactiveModules( processor ); // don't spend CPU on bypassed/dry modules
     processor.reset(); // flush any previous signal
+    // Skip processing (and output silence) while nobody is speaking and the
+    // effect tails have died out:
+    microphoneGate.attach( processor );
 
     Utility::DSPProfiler::singleton().setSignalSampleRate( processor.sampleRate() );
 
@@ -123,8 +140,10 @@ void JNICALL Java_demo_littleendiandemo_app_LESoundEffectsExampleActivity_render
         {
             Utility::DSPProfiler::singleton().beginInterval();
 
-            // So, how's this for a one-liner? ;-)
-            ModuleProcessor::singleton().process( data.pInputOutput, data.numberOfSampleFrames );
+            {
+                RealtimeHeapScope const noHeapAccess; // (see heapHooks.hpp)
+                microphoneGate.process( data.pInputOutput, data.numberOfSampleFrames );
+            }
 
             Utility::DSPProfiler::singleton().endInterval( data.numberOfSampleFrames );
         }
@@ -155,6 +174,10 @@ void JNICALL Java_demo_littleendiandemo_app_LESoundEffectsExampleActivity_stopAl
     microphoneRenderer               .stop ();
     AudioIO::Device     ::singleton().stop ();
     Utility::DSPProfiler::singleton().reset();
+    processingExampleAdvanced_stopped();
+
+    if ( auto const heapAccesses = realtimeHeapAccesses() )
+        Utility::Tracer::error( "%u heap accesses detected on the audio thread.", heapAccesses );
 }
 
 
@@ -173,6 +196,11 @@ jfloat JNICALL Java_demo_littleendiandemo_app_LESoundEffectsExampleActivity_upda
     auto & module       ( *Utility::JNI::unmarshalPointer<Module>( modulePtr ) );
     auto & parameterInfo( module.parameterInfo( parameterIndex ) );
     float const newValue( parameterInfo.minimum + ( parameterInfo.maximum - parameterInfo.minimum ) * newValuePercentage / 100 );
+    // While rendering, let the audio thread apply the change in between frames
+    // (and report the value the module will store) otherwise (or if the queue
+    // is full) set it directly.
+    if ( processingExampleAdvanced_setParameter( module, static_cast<std::uint8_t>( parameterIndex ), newValue ) )
+        return ParameterAutomation::adjustedValue( module, static_cast<std::uint8_t>( parameterIndex ), newValue );
     return module.setParameter( static_cast<std::uint8_t>( parameterIndex ), newValue );
 }
 
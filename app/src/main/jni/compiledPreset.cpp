@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// compiledPreset.cpp
+/// ------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "compiledPreset.hpp"
+
+#include "engineSetup.hpp"
+
+#include <le/parameters/lfo.hpp>
+#include <le/spectrumworx/engine/moduleBase.hpp>
+#include <le/spectrumworx/engine/moduleChain.hpp>
+
+#include <cstring>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+using SW::Engine::ModuleBase;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Image layout
+////////////////////////////////////////////////////////////////////////////////
+//
+// Header
+// (ModuleRecord, float parameters[ numberOfParameters ],
+//  LFORecord lfos[ numberOfParameters - numberOfNonLFOBaseParameters ]) * numberOfModules
+//
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    char const magic[ 4 ] = { 'L', 'E', 'S', 'P' };
+
+    struct Header
+    {
+        char          magic[ 4 ]     ;
+        std::uint16_t version        ;
+        std::uint8_t  numberOfModules;
+        std::uint8_t  window         ;
+        std::uint16_t fftSize        ;
+        std::uint8_t  overlapFactor  ;
+        std::uint8_t  reserved       ;
+        float         gain           ;
+        float         wetness        ;
+    }; // struct Header
+
+    struct ModuleRecord
+    {
+        char         effectName[ 31 ] ; // null terminated
+        std::uint8_t numberOfParameters;
+    }; // struct ModuleRecord
+
+    struct LFORecord
+    {
+        float        period    ;
+        float        phase     ;
+        float        lowerBound;
+        float        upperBound;
+        std::uint8_t syncTypes ;
+        std::uint8_t waveform  ;
+        std::uint8_t enabled   ;
+        std::uint8_t reserved  ;
+    }; // struct LFORecord
+
+    static_assert( sizeof( Header       ) == 20, "Unexpected padding" );
+    static_assert( sizeof( ModuleRecord ) == 32, "Unexpected padding" );
+    static_assert( sizeof( LFORecord    ) == 20, "Unexpected padding" );
+
+    std::uint8_t numberOfLFOs( std::uint8_t const numberOfParameters ) { return numberOfParameters - ModuleBase::numberOfNonLFOBaseParameters; }
+
+    std::uint32_t moduleSize( std::uint8_t const numberOfParameters )
+    {
+        return sizeof( ModuleRecord ) + numberOfParameters * sizeof( float ) + numberOfLFOs( numberOfParameters ) * sizeof( LFORecord );
+    }
+
+    template <typename Record>
+    Record * append( std::vector<char> & image, std::uint32_t const count = 1 )
+    {
+        auto const offset( image.size() );
+        image.resize( offset + count * sizeof( Record ) ); // errchk
+        return reinterpret_cast<Record *>( &image[ offset ] );
+    }
+
+    // The same ordering constraints as when cloning LFOs apply (see
+    // moduleChainUtilities.cpp).
+    void applyLFO( LFORecord const & record, Parameters::LFO & lfo )
+    {
+        lfo.removeSyncType    ( Parameters::LFO::All );
+        lfo.addSyncType       ( static_cast<Parameters::LFO::SyncType>( record.syncTypes ) );
+        lfo.setPeriodInSeconds( record.period                                         );
+        lfo.setPhase          ( record.phase                                          );
+        lfo.setWaveform       ( static_cast<Parameters::LFO::Waveform>( record.waveform ) );
+        lfo.setUpperBound     ( 1                                                     );
+        lfo.setLowerBound     ( record.lowerBound                                     );
+        lfo.setUpperBound     ( record.upperBound                                     );
+        lfo.setEnabled        ( record.enabled != 0                                   );
+    }
+} // anonymous namespace
+
+
+////////////////////////////////////////////////////////////////////////////////
+// compilePreset()
+////////////////////////////////////////////////////////////////////////////////
+
+bool compilePreset( SW::Engine::ModuleProcessor const & source, std::vector<char> & image )
+{
+    auto const & chain( source.moduleChain() );
+
+    image.clear();
+    image.reserve( sizeof( Header ) + chain.size() * moduleSize( 32 ) ); // errchk
+
+    auto & header( *append<Header>( image ) );
+    std::memcpy( header.magic, magic, sizeof( magic ) );
+    header.version         = compiledPresetVersion;
+    header.numberOfModules = chain.size();
+    header.window          = source.windowFunction();
+    header.fftSize         = source.fftSize();
+    header.overlapFactor   = source.windowOverlappingFactor();
+    header.reserved        = 0;
+    header.gain            = source.gain();
+    header.wetness         = source.wetness();
+
+    for ( std::uint8_t index( 0 ); index < chain.size(); ++index )
+    {
+        auto const & module            ( chain[ index ] );
+        auto const   numberOfParameters( module.numberOfParameters() );
+
+        // (records are accessed by pointer because append() may reallocate)
+        auto const pRecord( append<ModuleRecord>( image ) );
+        auto const nameLength( std::strlen( module.effectName() ) );
+        if ( nameLength >= sizeof( pRecord->effectName ) )
+            return false;
+        std::memset( pRecord->effectName, 0, sizeof( pRecord->effectName ) );
+        std::memcpy( pRecord->effectName, module.effectName(), nameLength );
+        pRecord->numberOfParameters = numberOfParameters;
+
+        auto const pValues( append<float>( image, numberOfParameters ) );
+        for ( std::uint8_t parameter( 0 ); parameter < numberOfParameters; ++parameter )
+            pValues[ parameter ] = module.getParameter( parameter );
+
+        auto const pLFOs( append<LFORecord>( image, numberOfLFOs( numberOfParameters ) ) );
+        for ( std::uint8_t parameter( ModuleBase::numberOfNonLFOBaseParameters ); parameter < numberOfParameters; ++parameter )
+        {
+            auto const & lfo   ( module.lfo( parameter ) );
+            auto       & record( pLFOs[ parameter - ModuleBase::numberOfNonLFOBaseParameters ] );
+            record.period     = lfo.period    ();
+            record.phase      = lfo.phase     ();
+            record.lowerBound = lfo.lowerBound();
+            record.upperBound = lfo.upperBound();
+            record.syncTypes  = lfo.syncTypes ();
+            record.waveform   = static_cast<std::uint8_t>( lfo.waveForm() );
+            record.enabled    = lfo.enabled   ();
+            record.reserved   = 0;
+        }
+    }
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// loadCompiledPreset()
+////////////////////////////////////////////////////////////////////////////////
+
+bool loadCompiledPreset( SW::Engine::ModuleProcessor & target, char const * const pImage, std::uint32_t const imageSize )
+{
+    using namespace SW::Engine;
+
+    // Validate the complete image before touching the target.
+    if ( imageSize < sizeof( Header ) )
+        return false;
+    auto const & header( *reinterpret_cast<Header const *>( pImage ) );
+    if
+    (
+        ( std::memcmp( header.magic, magic, sizeof( magic ) ) != 0 ) ||
+        ( header.version       != compiledPresetVersion            ) ||
+        ( header.window        >= Constants::NumberOfWindows       ) ||
+        ( header.fftSize       <  Constants::minimumFFTSize        ) ||
+        ( header.fftSize       >  Constants::maximumFFTSize        ) ||
+        ( header.overlapFactor <  Constants::minimumOverlapFactor  ) ||
+        ( header.overlapFactor >  Constants::maximumOverlapFactor  )
+    )
+        return false;
+
+    std::uint32_t offset( sizeof( Header ) );
+    for ( std::uint8_t index( 0 ); index < header.numberOfModules; ++index )
+    {
+        if ( imageSize - offset < sizeof( ModuleRecord ) )
+            return false;
+        auto const & record( *reinterpret_cast<ModuleRecord const *>( pImage + offset ) );
+        if
+        (
+            ( record.effectName[ sizeof( record.effectName ) - 1 ] != 0           ) ||
+            ( record.numberOfParameters < ModuleBase::numberOfBaseParameters      ) ||
+            ( imageSize - offset < moduleSize( record.numberOfParameters )        )
+        )
+            return false;
+        offset += moduleSize( record.numberOfParameters );
+    }
+
+    // Create all the modules up front so that an unknown effect or an
+    // allocation failure leaves the target untouched.
+    std::vector<ModulePtr> modules;
+    modules.reserve( header.numberOfModules ); // errchk
+    offset = sizeof( Header );
+    for ( std::uint8_t index( 0 ); index < header.numberOfModules; ++index )
+    {
+        auto const & record( *reinterpret_cast<ModuleRecord const *>( pImage + offset ) );
+        auto const   pModule( ModuleBase::create( record.effectName ) );
+        if ( !pModule || ( pModule->numberOfParameters() != record.numberOfParameters ) )
+            return false;
+
+        auto const pValues( reinterpret_cast<float     const *>( &record + 1 ) );
+        auto const pLFOs  ( reinterpret_cast<LFORecord const *>( pValues + record.numberOfParameters ) );
+        for ( std::uint8_t parameter( 0 ); parameter < record.numberOfParameters; ++parameter )
+            pModule->setParameter( parameter, pValues[ parameter ] );
+        for ( std::uint8_t parameter( ModuleBase::numberOfNonLFOBaseParameters ); parameter < record.numberOfParameters; ++parameter )
+            applyLFO( pLFOs[ parameter - ModuleBase::numberOfNonLFOBaseParameters ], pModule->lfo( parameter ) );
+
+        modules.push_back( pModule );
+        offset += moduleSize( record.numberOfParameters );
+    }
+
+    // Snapshot the target so that a failure while applying the image (e.g. an
+    // allocation failure in setWOLAParameters() or append()) can be undone.
+    auto & chain( target.moduleChain() );
+    std::vector<ModulePtr> previousModules;
+    previousModules.reserve( chain.size() ); // errchk
+    for ( std::uint8_t index( 0 ); index < chain.size(); ++index )
+        previousModules.push_back( &chain[ index ] );
+    auto const previousWOLA   ( currentWOLAParameters( target ) );
+    auto const previousGain   ( target.gain   () );
+    auto const previousWetness( target.wetness() );
+
+    if
+    (
+        ( previousWOLA.fftSize       != header.fftSize       ) ||
+        ( previousWOLA.overlapFactor != header.overlapFactor ) ||
+        ( previousWOLA.window        != header.window        )
+    )
+    {
+        if ( !target.setWOLAParameters( header.fftSize, header.overlapFactor, static_cast<Constants::Window>( header.window ) ) )
+            return false;
+    }
+    target.setGain   ( header.gain    );
+    target.setWetness( header.wetness );
+
+    chain.clear();
+    for ( auto const & pModule : modules )
+    {
+        if ( !chain.append( pModule ) )
+        {
+            chain.clear();
+            for ( auto const & pPreviousModule : previousModules )
+                chain.append( pPreviousModule ); // (cannot fail: the chain held them before)
+            target.setGain   ( previousGain    );
+            target.setWetness( previousWetness );
+            target.setWOLAParameters( previousWOLA.fftSize, previousWOLA.overlapFactor, previousWOLA.window ); // errchk
+            return false;
+        }
+    }
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// verifyCompiledPreset()
+////////////////////////////////////////////////////////////////////////////////
+
+bool verifyCompiledPreset( SW::Engine::ModuleProcessor const & loaded )
+{
+    std::vector<char> image;
+    std::vector<char> roundTripImage;
+    auto const pRoundTrip( SW::Engine::ModuleProcessor::create() );
+    if
+    (
+        !pRoundTrip                                                                                         ||
+        !pRoundTrip->setAudioFormat( loaded.numberOfChannels(), loaded.sampleRate() )                       ||
+        !compilePreset     ( loaded     , image                                                           ) ||
+        !loadCompiledPreset( *pRoundTrip, &image[ 0 ], static_cast<std::uint32_t>( image.size() )         ) ||
+        !compilePreset     ( *pRoundTrip, roundTripImage                                                  )
+    )
+        return false;
+    // The image captures the complete setup so identical images mean
+    // identical setups.
+    return image == roundTripImage;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// compiledPreset.hpp
+/// ------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef compiledPreset_hpp__0BDDD120_413C_40F5_B07E_992136C60A80
+#define compiledPreset_hpp__0BDDD120_413C_40F5_B07E_992136C60A80
+#pragma once
+//------------------------------------------------------------------------------
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+#include <le/utility/filesystem.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <fcntl.h>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Compiled presets
+// ----------------
+//
+// ModuleProcessor::loadPreset() parses SpectrumWorx XML (.swp) presets which,
+// on low end devices, makes switching presets take a noticeable amount of
+// time. A compiled preset is a flat, versioned binary image of the same
+// setup (engine parameters, gain, wetness and, for each module, the effect
+// name, all the parameter values and LFO settings) that is read in place,
+// straight from a memory mapping of the file, without any parsing: the image
+// consists of fixed size, 4 byte aligned records that are only range checked
+// before being applied.
+//
+// The images are produced offline (or once, e.g. on first run) by
+// compilePreset() from an already loaded processor (i.e. the XML parser
+// validates and clamps the values). The byte order is the native (little
+// endian) one of all supported targets. Like XML presets, compiled presets
+// do not contain the audio format (number of channels and sample rate).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+std::uint16_t const compiledPresetVersion = 1;
+
+// Serialises <source>'s setup into <image> (returns false on allocation
+// failure or if the source cannot be represented, e.g. an overlong effect
+// name).
+bool compilePreset( LE::SW::Engine::ModuleProcessor const & source, std::vector<char> & image );
+
+template <LE::Utility::SpecialLocations location>
+bool compilePreset( LE::SW::Engine::ModuleProcessor const & source, char const * const outputFile )
+{
+    std::vector<char> image;
+    if ( !compilePreset( source, image ) )
+        return false;
+    auto file( LE::Utility::File::open<location>( outputFile, O_CREAT | O_TRUNC | O_WRONLY ) );
+    if ( !file )
+        return false;
+    return file.write( &image[ 0 ], static_cast<std::uint32_t>( image.size() ) ) == image.size();
+}
+
+// Replaces <target>'s engine parameters, gain, wetness and module chain with
+// the ones stored in the image. On failure (an invalid image, a different
+// version, an unknown effect or an allocation failure) the target keeps its
+// previous setup (the signal state of a target whose engine parameters were
+// changed is lost though).
+bool loadCompiledPreset( LE::SW::Engine::ModuleProcessor & target, char const * pImage, std::uint32_t imageSize );
+
+template <LE::Utility::SpecialLocations location>
+bool loadCompiledPreset( LE::SW::Engine::ModuleProcessor & target, char const * const presetFile )
+{
+    auto const mapping( LE::Utility::File::map<location>( presetFile ) );
+    if ( !mapping )
+        return false;
+    return loadCompiledPreset( target, mapping.begin(), mapping.size() );
+}
+
+// Checks that compiling <loaded> and loading the image into a fresh processor
+// (of the same audio format) reproduces <loaded>'s setup exactly, e.g. to
+// verify that presets loaded with loadPreset() survive compilation.
+bool verifyCompiledPreset( LE::SW::Engine::ModuleProcessor const & loaded );
+
+template <LE::Utility::SpecialLocations location>
+bool verifyCompiledPreset( char const * const presetFile, std::uint8_t const numberOfChannels = 1, std::uint32_t const sampleRate = 44100 )
+{
+    auto const pProcessor( LE::SW::Engine::ModuleProcessor::create() );
+    return
+        pProcessor                                                      &&
+        pProcessor->setAudioFormat( numberOfChannels, sampleRate )      &&
+        pProcessor->template loadPreset<location>( presetFile )         &&
+        verifyCompiledPreset( *pProcessor );
+}
+
+//------------------------------------------------------------------------------
+#endif // compiledPreset_hpp
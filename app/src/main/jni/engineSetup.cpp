@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// engineSetup.cpp
+/// ---------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "engineSetup.hpp"
+
+#include <le/audioio/device.hpp>
+
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+
+#include <le/utility/trace.hpp>
+
+#include <algorithm>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+
+
+WOLAParameters currentWOLAParameters( SW::Engine::ModuleProcessor const & processor )
+{
+    WOLAParameters const parameters =
+    {
+        processor.fftSize                (),
+        processor.windowOverlappingFactor(),
+        processor.windowFunction         ()
+    };
+    return parameters;
+}
+
+
+namespace
+{
+    void logEngineSetup( SW::Engine::ModuleProcessor const & processor )
+    {
+        Utility::Tracer::message
+        (
+            "Engine latency: %u samples (%u ms, FFT size %u, step %u).",
+            processor.latencyInSamples     (),
+            processor.latencyInMilliseconds(),
+            processor.fftSize              (),
+            processor.stepSize             ()
+        );
+    }
+} // anonymous namespace
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Low latency setup
+////////////////////////////////////////////////////////////////////////////////
+
+WOLAParameters lowLatencyWOLAParameters( WOLAParameters const preferred, std::uint32_t const sampleRate, float const maximumLatencyInMilliseconds, std::uint16_t const minimumFFTSize )
+{
+    using namespace SW::Engine;
+
+    auto const latencyBudgetInSamples( static_cast<std::uint32_t>( maximumLatencyInMilliseconds * sampleRate / 1000 ) );
+    auto const fftSizeFloor          ( std::max<std::uint16_t>( minimumFFTSize, Constants::minimumFFTSize ) );
+
+    WOLAParameters result( preferred );
+    while ( ( result.fftSize > latencyBudgetInSamples ) && ( result.fftSize / 2 >= fftSizeFloor ) )
+        result.fftSize /= 2;
+    return result;
+}
+
+
+bool setupLowLatencyEngine( SW::Engine::ModuleProcessor & processor, float const maximumLatencyInMilliseconds, std::uint16_t const minimumFFTSize )
+{
+    auto const preferred( currentWOLAParameters( processor ) );
+    auto const lowLatency( lowLatencyWOLAParameters( preferred, processor.sampleRate(), maximumLatencyInMilliseconds, minimumFFTSize ) );
+
+    if ( lowLatency.fftSize != preferred.fftSize )
+    {
+        if ( !processor.setWOLAParameters( lowLatency.fftSize, lowLatency.overlapFactor, lowLatency.window ) )
+            return false;
+    }
+
+    logEngineSetup( processor );
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Host block aligned setup
+////////////////////////////////////////////////////////////////////////////////
+
+WOLAParameters hostBlockAlignedWOLAParameters( WOLAParameters const preferred, std::uint16_t const hostBlockSize, std::uint16_t const minimumFFTSize )
+{
+    using namespace SW::Engine;
+
+    // The largest power of two that divides the host block size.
+    auto const maximumStep( static_cast<std::uint16_t>( hostBlockSize & ( ~hostBlockSize + 1 ) ) );
+
+    // Do not degrade the setup if no alignment is possible (e.g. odd sizes).
+    if ( maximumStep < Constants::minimumFFTSize / Constants::maximumOverlapFactor )
+        return preferred;
+
+    WOLAParameters result( preferred );
+    while ( result.fftSize / result.overlapFactor > maximumStep )
+    {
+        if ( result.overlapFactor < Constants::maximumOverlapFactor )
+            result.overlapFactor *= 2;
+        else
+        if ( result.fftSize / 2 >= minimumFFTSize )
+            result.fftSize /= 2;
+        else
+            return preferred; // the frequency resolution loss would outweigh the gain
+    }
+    return result;
+}
+
+
+bool setupHostBlockAlignedEngine( SW::Engine::ModuleProcessor & processor, std::uint16_t const hostBlockSize, std::uint16_t const minimumFFTSize )
+{
+    auto const preferred( currentWOLAParameters( processor ) );
+    auto const aligned  ( hostBlockAlignedWOLAParameters( preferred, hostBlockSize, minimumFFTSize ) );
+
+    if ( ( aligned.fftSize != preferred.fftSize ) || ( aligned.overlapFactor != preferred.overlapFactor ) )
+    {
+        if ( !processor.setWOLAParameters( aligned.fftSize, aligned.overlapFactor, aligned.window ) )
+            return false;
+    }
+
+    if ( hostBlockSize % processor.stepSize() )
+        Utility::Tracer::message( "Engine step (%u) does not divide the host block size (%u).", processor.stepSize(), hostBlockSize );
+    logEngineSetup( processor );
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Step synchronous IO
+////////////////////////////////////////////////////////////////////////////////
+
+bool setupStepSynchronousIO( AudioIO::Device & device, SW::Engine::ModuleProcessor & processor )
+{
+    if ( auto const error = device.setup( processor.numberOfChannels(), processor.sampleRate(), processor.stepSize() ) )
+    {
+        Utility::Tracer::error( "Audio device setup failed: %s.", error );
+        return false;
+    }
+    return setupHostBlockAlignedEngine( processor, device.latency().second, processor.fftSize() );
+}
+
+//------------------------------------------------------------------------------
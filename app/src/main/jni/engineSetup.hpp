@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// engineSetup.hpp
+/// ---------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef engineSetup_hpp__63778B91_D3C6_4F6D_B672_9BABDF302415
+#define engineSetup_hpp__63778B91_D3C6_4F6D_B672_9BABDF302415
+#pragma once
+//------------------------------------------------------------------------------
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+
+#include <cstdint>
+//------------------------------------------------------------------------------
+namespace LE { namespace AudioIO { class Device; } }
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Helpers for choosing the WOLA (Windowed-Overlap-And-Add) engine parameters
+// for a particular use case.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+struct WOLAParameters
+{
+    std::uint16_t                     fftSize      ;
+    std::uint8_t                      overlapFactor;
+    LE::SW::Engine::Constants::Window window       ;
+}; // struct WOLAParameters
+
+WOLAParameters currentWOLAParameters( LE::SW::Engine::ModuleProcessor const & );
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Low latency setup.
+//
+// The latency of the SW engine equals the FFT size (ModuleProcessor::
+// latencyInSamples()) so, for latency critical paths (e.g. live voice chat),
+// the frame size is the only knob: lowLatencyWOLAParameters() halves the
+// preferred FFT size until the resulting latency fits into the given budget
+// (or <minimumFFTSize> is reached) while the overlap factor and window are
+// left untouched (so that the time resolution of the effects does not change).
+// Smaller frames cost frequency resolution which pitch shifting and
+// autotuning presets in particular do not tolerate (hence the 1024 default
+// floor, which may well not fit the budget) so this is an opt-in for paths
+// whose presets were checked at the reduced FFT size: the examples' live
+// input paths keep the presets' own engine setup.
+////////////////////////////////////////////////////////////////////////////////
+
+std::uint16_t const minimumLowLatencyFFTSize = 1024;
+
+WOLAParameters lowLatencyWOLAParameters( WOLAParameters preferred, std::uint32_t sampleRate, float maximumLatencyInMilliseconds, std::uint16_t minimumFFTSize = minimumLowLatencyFFTSize );
+
+// Applies lowLatencyWOLAParameters() to an already setup processor (e.g. after
+// a call to loadPreset()) and logs the resulting engine latency.
+bool setupLowLatencyEngine( LE::SW::Engine::ModuleProcessor &, float maximumLatencyInMilliseconds, std::uint16_t minimumFFTSize = minimumLowLatencyFFTSize );
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Host block aligned setup.
+//
+// The engine only supports power of two FFT sizes while many hosts (e.g. VoIP
+// stacks with 10 ms framing: 480 samples at 48 kHz) deliver blocks of other
+// sizes. If the engine step does not divide the host block size, the number
+// of frames (and so the CPU load) per callback alternates between callbacks
+// and the engine has to buffer the partial step. hostBlockAlignedWOLAParameters()
+// picks the largest power of two step that divides the host block size by
+// first raising the overlap factor (keeping the frequency resolution) and only
+// then lowering the FFT size, but never below <minimumFFTSize>: if alignment
+// would require a smaller FFT the preferred setup is returned unchanged (the
+// coarser frequency resolution and the additional frames per second would
+// cost more than the buffering saves). E.g. a 256 sample host block with a
+// preferred FFT size of 2048 and overlap factor 4 gives 2048/8 (step 256)
+// while a 480 sample one (largest power of two divisor: 32) keeps 2048/4.
+// Higher overlap factors also cost CPU (more frames per second) so this is a
+// trade-off of average load against jitter.
+////////////////////////////////////////////////////////////////////////////////
+
+std::uint16_t const minimumHostBlockAlignedFFTSize = 1024;
+
+WOLAParameters hostBlockAlignedWOLAParameters( WOLAParameters preferred, std::uint16_t hostBlockSize, std::uint16_t minimumFFTSize = minimumHostBlockAlignedFFTSize );
+
+bool setupHostBlockAlignedEngine( LE::SW::Engine::ModuleProcessor &, std::uint16_t hostBlockSize, std::uint16_t minimumFFTSize = minimumHostBlockAlignedFFTSize );
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Step synchronous IO.
+//
+// setupStepSynchronousIO() sets the device up for the processor's audio format
+// asking for one engine step per callback (the device treats this only as a
+// hint) and then aligns the engine step with the buffer size the device
+// actually chose (see setupHostBlockAlignedEngine()) but only by raising the
+// overlap factor: the processor's FFT size (and so the preset's frequency
+// resolution) is kept, if that is not enough the engine setup is left as is.
+// Note that the device buffer size (Device::latency().second) is only an upper
+// bound on the number of frames per callback: full buffers then consist of
+// whole engine steps (constant CPU load per callback, no partial step carried
+// in the engine's FIFOs) but shorter callbacks can still occur. As raising the
+// overlap factor costs CPU (more frames per second) this is an opt-in for
+// hosts that value an even load over the average one (the examples' live
+// input paths do not use it). Call it after the processor has been set up and
+// before anything that depends on the engine parameters (e.g.
+// SilenceGate::attach()).
+////////////////////////////////////////////////////////////////////////////////
+
+bool setupStepSynchronousIO( LE::AudioIO::Device &, LE::SW::Engine::ModuleProcessor & );
+
+//------------------------------------------------------------------------------
+#endif // engineSetup_hpp
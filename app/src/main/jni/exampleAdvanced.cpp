@@ -10,6 +10,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 //------------------------------------------------------------------------------
 #include "exampleAdvanced.hpp"
+#include "moduleChainUtilities.hpp"
+#include "parameterAutomation.hpp"
 
 #include <le/audioio/device.hpp>
 #include <le/audioio/file.hpp>
@@ -30,7 +32,9 @@
 #include <le/utility/profiler.hpp>
 #include <le/utility/trace.hpp>
 
+#include <atomic>
 #include <cassert>
+#include <thread>
 //------------------------------------------------------------------------------
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -46,6 +50,30 @@
 
 using namespace LE;
 
+namespace
+{
+    // Parameter changes from the UI thread are routed through the automation
+    // queue so that they never race with the processing of a frame.
+    ParameterAutomation parameterAutomation;
+    // Changes are only queued while rendering (otherwise nothing would apply
+    // them and the next attach() would discard them). The audio callbacks
+    // flag the automation as in use before checking <rendering> so that the
+    // control thread, after clearing <rendering>, can wait for the last
+    // consumer to leave the queue before it takes it over (see
+    // stopAutomation()).
+    std::atomic<bool>   rendering      ( false );
+    std::atomic<bool>   automationInUse( false );
+
+    // Control thread.
+    void stopAutomation()
+    {
+        rendering.store( false );
+        while ( automationInUse.load() )
+            std::this_thread::yield();
+        parameterAutomation.flush();
+    }
+} // anonymous namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // setupRenderingObjects() (helper for processingExampleAdvanced_* functions)
@@ -165,6 +193,14 @@ void setupRenderingObjects
     moduleChain.append( pFreqverb     ); // errchk
     moduleChain.append( pBlender      ); // errchk
 
+    parameterAutomation.attach( processor );
+    // Glide (rather than jump) to new values set through the UI in order to
+    // avoid zipper noise:
+    auto const uiRampTimeInMilliseconds( 80 );
+    parameterAutomation.setRampTime( *pPitchShifter, pPitchShifter->parameterIndex<PitchShifter::SemiTones>(), uiRampTimeInMilliseconds );
+    parameterAutomation.setRampTime( *pFreqverb    , pFreqverb    ->parameterIndex<Freqverb    ::Time60dB >(), uiRampTimeInMilliseconds );
+    parameterAutomation.setRampTime( *pBlender     , pBlender     ->parameterIndex<Blender     ::Amount   >(), uiRampTimeInMilliseconds );
+
     AudioIO::Device::singleton().setup( numberOfChannels, sampleRate ); // errchk
 
     Utility::DSPProfiler::singleton().setSignalSampleRate( sampleRate );
@@ -192,8 +228,21 @@ struct MicRenderer
     #else // MSVC does not support VLAs so we have to use alloca
         float * sideChainData( (float *)_alloca( data.numberOfSampleFrames * sizeof( float ) ) );
     #endif // compiler
-        sideChainAudioInputFile     .readLooped(                    sideChainData,                    data.numberOfSampleFrames ); // errchk
-        ModuleProcessor::singleton().process   ( data.pInputOutput, sideChainData, data.pInputOutput, data.numberOfSampleFrames );
+        // Decode (and have the engine analyse) the side chain signal only
+        // while a module that uses it is active (e.g. the Blender was not
+        // bypassed):
+        float const * pSideChainData( nullptr );
+        if ( sideChannelRequired( ModuleProcessor::singleton() ) )
+        {
+            sideChainAudioInputFile .readLooped(                    sideChainData,                    data.numberOfSampleFrames ); // errchk
+            pSideChainData = sideChainData;
+        }
+        automationInUse.store( true );
+        if ( rendering.load() )
+            parameterAutomation     .process   ( data.pInputOutput, pSideChainData,                   data.numberOfSampleFrames );
+        else // (a callback after stopAutomation() or the end of the file)
+            ModuleProcessor::singleton().process( data.pInputOutput, pSideChainData, data.pInputOutput, data.numberOfSampleFrames );
+        automationInUse.store( false, std::memory_order_release );
         asyncOutputFile             .write     (                                   data.pInputOutput, data.numberOfSampleFrames ); // errchk
 
         Utility::DSPProfiler::singleton().endInterval( data.numberOfSampleFrames );
@@ -217,6 +266,7 @@ void processingExampleAdvanced_microphone()
     // Thanks to the moveability of AudioIO *File* objects, here we can simply
     // move the renderer object 'into' the Device instance and 'forget about it'.
     AudioIO::Device::singleton().setCallback( std::move( renderer ) ); // errchk
+    rendering.store( true, std::memory_order_release );
     AudioIO::Device::singleton().start();
 } // processingExampleAdvanced_microphone
 
@@ -241,6 +291,9 @@ struct FileRenderer : MicRenderer
         if ( readSampleFrames < data.numberOfSampleFrames )
         {
             AudioIO::Device::singleton().stop();
+            // Stop queuing (the control thread applies what is left, see
+            // processingExampleAdvanced_setParameter()/_stopped()).
+            rendering.store( false );
             exampleUICallback_processingStopped();
         }
     }
@@ -263,7 +316,31 @@ void processingExampleAdvanced_file( char const * const inputAudioPath )
     assert( AudioIO::equalFormats( renderer.inputAudioFile, renderer.sideChainAudioInputFile ) );
 
     AudioIO::Device::singleton().setCallback( std::move( renderer ) ); // errchk
+    rendering.store( true, std::memory_order_release );
     AudioIO::Device::singleton().start();
 } // processingExampleAdvanced_file
 
+
+////////////////////////////////////////////////////////////////////////////////
+// processingExampleAdvanced_setParameter()
+////////////////////////////////////////////////////////////////////////////////
+
+bool processingExampleAdvanced_setParameter( SW::Engine::ModuleBase & module, std::uint8_t const parameterIndex, float const value )
+{
+    if ( rendering.load() )
+        return parameterAutomation.post( module, parameterIndex, value );
+    // Rendering ended on its own (end of the input file): apply the changes
+    // still queued before the caller sets this one directly, so that they do
+    // not overwrite it later.
+    stopAutomation();
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// processingExampleAdvanced_stopped()
+////////////////////////////////////////////////////////////////////////////////
+
+void processingExampleAdvanced_stopped() { stopAutomation(); }
+
 //------------------------------------------------------------------------------
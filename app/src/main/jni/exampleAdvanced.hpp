@@ -21,6 +21,15 @@
 void processingExampleAdvanced_microphone(                             );
 void processingExampleAdvanced_file      ( char const * inputAudioPath );
 
+// Control (UI) thread: queues a parameter change to be applied by the audio
+// thread. Returns false if rendering is not running (or the queue is full):
+// the caller then has to set the parameter directly.
+bool processingExampleAdvanced_setParameter( LE::SW::Engine::ModuleBase & module, std::uint8_t parameterIndex, float value );
+// Control (UI) thread, once the audio device has been stopped: waits for a
+// callback that may still be running to stop using the queue and applies the
+// changes that were still queued.
+void processingExampleAdvanced_stopped();
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //
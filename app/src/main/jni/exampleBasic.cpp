@@ -10,6 +10,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 //------------------------------------------------------------------------------
 #include "exampleBasic.hpp"
+#include "heapHooks.hpp"
+#include "moduleChainUtilities.hpp"
 
 #include <le/audioio/device.hpp>
 #include <le/audioio/file.hpp>
@@ -58,6 +60,7 @@ void processingExample_FileOffline( char const * inputAudioFile, char const * ou
     SW::Engine::ModuleProcessor processor;
     processor.setAudioFormat( inputFile.numberOfChannels(), inputFile.sampleRate() ); // errchk
     processor.loadPreset<Utility::ToolResources>( presetFile ); // errchk
+    removeInactiveModules( processor ); // presets often contain bypassed/dry modules
 
     ////////////////////////////////////////////////////////////////////////////
     // Process the data in blocks:
@@ -117,6 +120,7 @@ void ExampleFileRenderer::setup( char const * inputAudioFile, char const * prese
     file_     .open      <Utility::ToolResources>( inputAudioFile                               ); // errchk
     processor_.setAudioFormat                    ( file_.numberOfChannels(), file_.sampleRate() ); // errchk
     processor_.loadPreset<Utility::ToolResources>( presetFile                                   ); // errchk
+    removeInactiveModules( processor_ );
     device_   .setup                             ( file_.numberOfChannels(), file_.sampleRate() ); // errchk
     device_   .setCallback                       ( this, &ExampleFileRenderer::callback         ); // errchk
 
@@ -131,7 +135,10 @@ void ExampleFileRenderer::callback( ExampleFileRenderer * pPlayer, AudioIO::Devi
     Utility::DSPProfiler::singleton().beginInterval();
 
     unsigned int readSampleFrames = pPlayer->file_.read( data.pOutput, data.numberOfSampleFrames );
-    pPlayer->processor_.process( data.pOutput, readSampleFrames );
+    {
+        RealtimeHeapScope const noHeapAccess; // (file decoding may allocate)
+        pPlayer->processor_.process( data.pOutput, readSampleFrames );
+    }
     if ( readSampleFrames < data.numberOfSampleFrames )
     {
         pPlayer->device_.stop();
@@ -150,6 +157,8 @@ void ExampleLiveInputRenderer::setup( char const * presetFile )
 {
     processor_.setAudioFormat                    ( 1, 44100   ); // errchk
     processor_.loadPreset<Utility::ToolResources>( presetFile ); // errchk
+    removeInactiveModules( processor_ );
+    gate_.attach( processor_ );
 
     device_.setup      ( processor_.numberOfChannels(), processor_.sampleRate() ); // errchk
     device_.setCallback( this, &ExampleLiveInputRenderer::callback              ); // errchk
@@ -164,7 +173,10 @@ void ExampleLiveInputRenderer::callback( ExampleLiveInputRenderer * pRenderer, A
 {
     Utility::DSPProfiler::singleton().beginInterval();
 
-    pRenderer->processor_.process( data.pInputOutput, data.numberOfSampleFrames );
+    {
+        RealtimeHeapScope const noHeapAccess;
+        pRenderer->gate_.process( data.pInputOutput, data.numberOfSampleFrames );
+    }
 
     Utility::DSPProfiler::singleton().endInterval( data.numberOfSampleFrames );
 }
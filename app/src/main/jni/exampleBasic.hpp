@@ -13,6 +13,8 @@
 #define exampleBasic_hpp__CF35DB4E_632E_4F88_918D_525F3E43E5D2
 #pragma once
 //------------------------------------------------------------------------------
+#include "silenceGate.hpp"
+
 #include <le/audioio/device.hpp>
 #include <le/audioio/file.hpp>
 #include <le/audioio/inputWaveFile.hpp>
@@ -110,6 +112,7 @@ private:
 private:
     AudioIO::Device             device_   ;
     SW::Engine::ModuleProcessor processor_;
+    SilenceGate                 gate_     ; // microphone input is mostly silence
 }; // class ExampleLiveInputRenderer
 
 
@@ -0,0 +1,294 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// featureExtraction.cpp
+/// ---------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "featureExtraction.hpp"
+
+#include <cmath>
+#include <utility>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+
+
+namespace
+{
+    float const minimumPitchInHz =   50;
+    float const maximumPitchInHz = 1000;
+
+    // Minimum normalised autocorrelation (at the pitch period) for a frame
+    // to be considered periodic.
+    float const voicingThreshold = 0.3f;
+
+    // Fraction of the strongest autocorrelation peak that a shorter lag peak
+    // has to reach to be taken as the period.
+    float const subharmonicTolerance = 0.9f;
+
+    // Lags at which the window's autocorrelation falls below this fraction of
+    // its energy are not searched (the normalisation would mostly amplify
+    // noise there).
+    float const minimumWindowCorrelation = 0.05f;
+
+    float const pi( 3.14159265358979f );
+
+    bool isPowerOfTwo( std::uint32_t const value ) { return value && !( value & ( value - 1 ) ); }
+
+    // Periodic (DFT-even) versions of the engine's window functions.
+    float windowValue( SW::Engine::Constants::Window const window, std::uint16_t const sample, std::uint16_t const size )
+    {
+        using namespace SW::Engine::Constants;
+        float const x       ( static_cast<float>( sample ) / size );
+        float const centered( 2 * x - 1 ); // [-1, 1)
+        auto  const cosine  ( [ = ]( unsigned const harmonic ) { return std::cos( 2 * pi * harmonic * x ); } );
+        switch ( window )
+        {
+            case Hann          : return 0.5f - 0.5f * cosine( 1 );
+            case Hamming       : return 0.54f - 0.46f * cosine( 1 );
+            case Blackman      : return 0.42f - 0.5f * cosine( 1 ) + 0.08f * cosine( 2 );
+            case BlackmanHarris: return 0.35875f - 0.48829f * cosine( 1 ) + 0.14128f * cosine( 2 ) - 0.01168f * cosine( 3 );
+            case Gaussian      : return std::exp( -0.5f * ( centered / 0.4f ) * ( centered / 0.4f ) );
+            case FlatTop       : return 0.21557895f - 0.41663158f * cosine( 1 ) + 0.277263158f * cosine( 2 ) - 0.083578947f * cosine( 3 ) + 0.006947368f * cosine( 4 );
+            case Welch         : return 1 - centered * centered;
+            case Triangle      : return 1 - std::abs( centered );
+            default            : return 1;
+        }
+    }
+} // anonymous namespace
+
+
+FeatureExtractor::FeatureExtractor()
+    :
+    sampleRate_( 0 ),
+    stepSize_  ( 0 ),
+    minimumLag_( 0 ),
+    maximumLag_( 0 ),
+    fill_      ( 0 ),
+    position_  ( 0 )
+{}
+
+
+bool FeatureExtractor::setup( std::uint32_t const sampleRate, std::uint16_t const fftSize, std::uint8_t const overlapFactor, SW::Engine::Constants::Window const window )
+{
+    using namespace SW::Engine;
+
+    if
+    (
+        !sampleRate                                       ||
+        !isPowerOfTwo( fftSize       )                    ||
+        !isPowerOfTwo( overlapFactor )                    ||
+        ( fftSize       < Constants::minimumFFTSize       ) ||
+        ( fftSize       > Constants::maximumFFTSize       ) ||
+        ( overlapFactor < Constants::minimumOverlapFactor ) ||
+        ( overlapFactor > Constants::maximumOverlapFactor ) ||
+        ( window        >= Constants::NumberOfWindows     )
+    )
+        return false;
+
+    std::uint32_t const transformSize( 2 * fftSize );
+
+    sampleRate_ = sampleRate;
+    stepSize_   = fftSize / overlapFactor;
+
+    frame_      .resize( fftSize       ); // errchk
+    window_     .resize( fftSize       ); // errchk
+    real_       .resize( transformSize ); // errchk
+    imaginary_  .resize( transformSize ); // errchk
+    cosines_    .resize( fftSize       ); // errchk
+    sines_      .resize( fftSize       ); // errchk
+    bitReversed_.resize( transformSize ); // errchk
+
+    for ( std::uint16_t sample( 0 ); sample < fftSize; ++sample )
+        window_[ sample ] = windowValue( window, sample, fftSize );
+    for ( std::uint16_t bin( 0 ); bin < fftSize; ++bin )
+    {
+        cosines_[ bin ] = std::cos( 2 * pi * bin / transformSize );
+        sines_  [ bin ] = std::sin( 2 * pi * bin / transformSize );
+    }
+    std::uint16_t bits( 0 );
+    while ( ( 1U << bits ) < transformSize )
+        ++bits;
+    for ( std::uint32_t index( 0 ); index < transformSize; ++index )
+    {
+        std::uint16_t reversed( 0 );
+        for ( std::uint16_t bit( 0 ); bit < bits; ++bit )
+            reversed |= ( ( index >> bit ) & 1 ) << ( bits - 1 - bit );
+        bitReversed_[ index ] = reversed;
+    }
+
+    // Lag range: at most half a frame and only as far as the window leaves
+    // enough overlap (+ 1 for the neighbour the peak test looks at).
+    auto const pReal     ( &real_     [ 0 ] );
+    auto const pImaginary( &imaginary_[ 0 ] );
+    std::copy( window_.begin(), window_.end(), pReal );
+    std::fill( pReal + fftSize, pReal + transformSize, 0.0f );
+    std::fill( pImaginary, pImaginary + transformSize, 0.0f );
+    fft            ( pReal, pImaginary );
+    autocorrelation( pReal, pImaginary );
+    minimumLag_ = static_cast<std::uint16_t>( std::max<std::uint32_t>( 2, static_cast<std::uint32_t>( sampleRate / maximumPitchInHz ) ) );
+    maximumLag_ = static_cast<std::uint16_t>( std::min<std::uint32_t>( fftSize / 2, static_cast<std::uint32_t>( sampleRate / minimumPitchInHz ) ) );
+    windowCorrelation_.resize( maximumLag_ + 1 ); // errchk
+    for ( std::uint16_t lag( 0 ); lag <= maximumLag_; ++lag )
+    {
+        windowCorrelation_[ lag ] = pReal[ lag ] / pReal[ 0 ];
+        if ( windowCorrelation_[ lag ] < minimumWindowCorrelation )
+        {
+            maximumLag_ = lag - 1;
+            break;
+        }
+    }
+
+    reset();
+    return true;
+}
+
+
+void FeatureExtractor::reset()
+{
+    std::fill( frame_.begin(), frame_.end(), 0.0f );
+    fill_     = fftSize() - stepSize();
+    position_ = 0;
+}
+
+
+// In-place, iterative radix-2 (decimation in time) forward FFT (of the zero
+// padded, 2 * fftSize, length).
+void FeatureExtractor::fft( float * const pReal, float * const pImaginary ) const
+{
+    std::uint32_t const size( static_cast<std::uint32_t>( real_.size() ) );
+    for ( std::uint32_t index( 0 ); index < size; ++index )
+    {
+        std::uint32_t const reversed( bitReversed_[ index ] );
+        if ( index < reversed )
+        {
+            std::swap( pReal     [ index ], pReal     [ reversed ] );
+            std::swap( pImaginary[ index ], pImaginary[ reversed ] );
+        }
+    }
+
+    for ( std::uint32_t butterflySize( 2 ); butterflySize <= size; butterflySize *= 2 )
+    {
+        auto const halfSize   ( butterflySize / 2    );
+        auto const twiddleStep( size / butterflySize );
+        for ( std::uint32_t start( 0 ); start < size; start += butterflySize )
+        {
+            for ( std::uint32_t k( 0 ); k < halfSize; ++k )
+            {
+                float const c( cosines_[ k * twiddleStep ] );
+                float const s( sines_  [ k * twiddleStep ] );
+                auto  const a( start + k    );
+                auto  const b( a + halfSize );
+                float const real     ( pReal[ b ] * c + pImaginary[ b ] * s );
+                float const imaginary( pImaginary[ b ] * c - pReal[ b ] * s );
+                pReal     [ b ]  = pReal     [ a ] - real     ;
+                pImaginary[ b ]  = pImaginary[ a ] - imaginary;
+                pReal     [ a ] += real     ;
+                pImaginary[ a ] += imaginary;
+            }
+        }
+    }
+}
+
+
+// Replaces a transformed (real) signal with its (linear, given enough zero
+// padding) autocorrelation: the transform of the power spectrum (which is
+// real and even, so the forward FFT does the inverse up to scaling).
+void FeatureExtractor::autocorrelation( float * const pReal, float * const pImaginary ) const
+{
+    auto const size( real_.size() );
+    for ( std::uint32_t bin( 0 ); bin < size; ++bin )
+    {
+        pReal     [ bin ] = pReal[ bin ] * pReal[ bin ] + pImaginary[ bin ] * pImaginary[ bin ];
+        pImaginary[ bin ] = 0;
+    }
+    fft( pReal, pImaginary );
+}
+
+
+FrameFeatures FeatureExtractor::analyse()
+{
+    auto const size    ( fftSize() );
+    auto const halfSize( static_cast<std::uint16_t>( size / 2 ) );
+    auto const pReal     ( &real_     [ 0 ] );
+    auto const pImaginary( &imaginary_[ 0 ] );
+
+    for ( std::uint16_t sample( 0 ); sample < size; ++sample )
+        pReal[ sample ] = frame_[ sample ] * window_[ sample ];
+    std::fill( pReal + size, pReal + 2 * size, 0.0f );
+    std::fill( pImaginary, pImaginary + 2 * size, 0.0f );
+    fft( pReal, pImaginary );
+
+    FrameFeatures features;
+    features.position = position_;
+    features.peakBin  = 0;
+
+    // Centroid and peak from the magnitudes. Every other bin of the zero
+    // padded transform is a bin of the fftSize one.
+    float weightedMagnitudes( 0 );
+    float totalMagnitude    ( 0 );
+    float peakPower         ( 0 );
+    for ( std::uint16_t bin( 0 ); bin <= halfSize; ++bin )
+    {
+        float const power    ( pReal[ 2 * bin ] * pReal[ 2 * bin ] + pImaginary[ 2 * bin ] * pImaginary[ 2 * bin ] );
+        float const magnitude( std::sqrt( power ) );
+        weightedMagnitudes += bin * magnitude;
+        totalMagnitude     +=       magnitude;
+        if ( bin && ( power > peakPower ) )
+        {
+            peakPower        = power;
+            features.peakBin = bin;
+        }
+    }
+    features.centroidInHz = ( totalMagnitude > 0 ) ? weightedMagnitudes / totalMagnitude * binWidthInHz() : 0;
+
+    // Dividing by the window's autocorrelation undoes the decay of the
+    // correlation with the lag (caused by the shrinking window overlap).
+    autocorrelation( pReal, pImaginary );
+    auto const correlation( [ = ]( std::uint32_t const lag ) { return pReal[ lag ] / windowCorrelation_[ lag ]; } );
+    auto const isPeak( [ = ]( std::uint32_t const lag, float const current ) { return ( current > correlation( lag - 1 ) ) && ( current >= correlation( lag + 1 ) ); } );
+    features.pitchInHz = 0;
+    // Multiples of the period correlate (nearly) as well as the period itself
+    // so the first peak that comes close to the strongest one is taken.
+    float strongestCorrelation( voicingThreshold * pReal[ 0 ] );
+    for ( std::uint32_t lag( minimumLag_ ); lag < maximumLag_; ++lag )
+    {
+        float const current( correlation( lag ) );
+        if ( ( current > strongestCorrelation ) && isPeak( lag, current ) )
+            strongestCorrelation = current;
+    }
+    float         bestCorrelation( 0 );
+    std::uint32_t bestLag        ( 0 );
+    for ( std::uint32_t lag( minimumLag_ ); lag < maximumLag_; ++lag )
+    {
+        float const current( correlation( lag ) );
+        if ( ( current >= subharmonicTolerance * strongestCorrelation ) && ( current > voicingThreshold * pReal[ 0 ] ) && isPeak( lag, current ) )
+        {
+            bestCorrelation = current;
+            bestLag         = lag;
+            break;
+        }
+    }
+    if ( bestLag && ( pReal[ 0 ] > 0 ) )
+    {
+        // Parabolic interpolation of the peak.
+        float const before( correlation( bestLag - 1 ) );
+        float const after ( correlation( bestLag + 1 ) );
+        float const denominator( before - 2 * bestCorrelation + after );
+        float const offset( ( denominator != 0 ) ? 0.5f * ( before - after ) / denominator : 0 );
+        features.pitchInHz = sampleRate_ / ( bestLag + offset );
+    }
+
+    // Slide the frame by one step.
+    std::copy( frame_.begin() + stepSize(), frame_.end(), frame_.begin() );
+    fill_ = size - stepSize();
+
+    return features;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// featureExtraction.hpp
+/// ---------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef featureExtraction_hpp__66E11D42_D3F2_40B4_A57F_860C7789CA05
+#define featureExtraction_hpp__66E11D42_D3F2_40B4_A57F_860C7789CA05
+#pragma once
+//------------------------------------------------------------------------------
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// FeatureExtractor
+// ----------------
+//
+// Running a ModuleProcessor with analysis effects (e.g. CentroidExtractor or
+// PitchFollower) only to read their results still costs a full STFT round
+// trip: the inverse FFT, overlap-add and the output of every frame are
+// computed and then thrown away. For tagging/indexing jobs that only need the
+// information the FeatureExtractor runs just the analysis half of an STFT
+// (framing, window and forward FFT) and computes, per step:
+// - the spectral centroid (magnitude weighted mean frequency)
+// - the peak bin (of the magnitude spectrum, DC excluded)
+// - the pitch (from the autocorrelation computed through the power spectrum,
+//   zero when no periodicity is detected).
+//
+// The framing (FFT size, step size and window type) can be set to match a
+// processor's engine setup so that the features describe the same frames
+// that the processor's effects see. Like the engine, the first frame is
+// preceded by fftSize - stepSize zeros. The windows use their textbook
+// definitions (the engine does not document e.g. its Gaussian's width).
+//
+// The frames are zero padded to twice the FFT size for the autocorrelation
+// (so it is linear rather than circular) which is then normalised by the
+// window's own autocorrelation. Periods of up to half a frame, where the
+// window still leaves enough signal to correlate, are detected: the pitch
+// range is [ max( 50, 2 * sampleRate / fftSize ), 1000 ] Hz with a Hann
+// window (e.g. from 86 Hz at 44.1 kHz with a 1024 sample FFT, use 2048 for
+// low male voices) and narrower with windows that taper more (e.g.
+// Blackman-Harris or flat top), see lowestDetectablePitchInHz().
+// Mono input: downmix (or pick a channel of) multichannel signals first.
+// setup() allocates, process() does not.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+struct FrameFeatures
+{
+    std::uint32_t position         ; // sample frames consumed up to the end of the frame
+    float         centroidInHz     ;
+    std::uint16_t peakBin          ;
+    float         pitchInHz        ; // 0 = no pitch detected
+}; // struct FrameFeatures
+
+class FeatureExtractor
+{
+public:
+    FeatureExtractor();
+
+    bool setup( std::uint32_t sampleRate, std::uint16_t fftSize, std::uint8_t overlapFactor, LE::SW::Engine::Constants::Window = LE::SW::Engine::Constants::Hann );
+    bool setup( LE::SW::Engine::ModuleProcessor const & processor ) { return setup( processor.sampleRate(), processor.fftSize(), processor.windowOverlappingFactor(), processor.windowFunction() ); }
+
+    // Clears the analysis history and the stream position.
+    void reset();
+
+    // Calls <consumer>( FrameFeatures const & ) for each completed step. Does
+    // nothing before a successful setup().
+    template <typename Consumer>
+    void process( float const * pInput, std::uint32_t sampleFrames, Consumer && consumer )
+    {
+        if ( frame_.empty() )
+            return;
+        while ( sampleFrames )
+        {
+            auto const frames( std::min<std::uint32_t>( sampleFrames, fftSize() - fill_ ) );
+            std::copy( pInput, pInput + frames, &frame_[ fill_ ] );
+            fill_        += frames;
+            position_    += frames;
+            pInput       += frames;
+            sampleFrames -= frames;
+            if ( fill_ == fftSize() )
+                consumer( analyse() );
+        }
+    }
+
+    std::uint16_t fftSize () const { return static_cast<std::uint16_t>( frame_.size() ); }
+    std::uint16_t stepSize() const { return stepSize_; }
+    float         binWidthInHz() const { return static_cast<float>( sampleRate_ ) / fftSize(); }
+
+    // Pitches below this are reported as 0 (or as a multiple of the true
+    // pitch) with the current setup.
+    float lowestDetectablePitchInHz() const { return static_cast<float>( sampleRate_ ) / maximumLag_; }
+
+private:
+    FrameFeatures analyse();
+
+    void fft            ( float * pReal, float * pImaginary ) const;
+    void autocorrelation( float * pReal, float * pImaginary ) const;
+
+private:
+    std::uint32_t sampleRate_;
+    std::uint16_t stepSize_  ;
+    std::uint16_t minimumLag_;
+    std::uint16_t maximumLag_;
+
+    std::vector<float>         frame_            ; // the current analysis frame (in time order)
+    std::vector<float>         window_           ;
+    std::vector<float>         windowCorrelation_; // normalised, lags 0 to maximumLag_
+    std::vector<float>         real_             ; // 2 * fftSize (zero padded)
+    std::vector<float>         imaginary_        ;
+    std::vector<float>         cosines_          ; // FFT twiddles (fftSize)
+    std::vector<float>         sines_            ;
+    std::vector<std::uint16_t> bitReversed_      ;
+
+    std::uint16_t fill_    ;
+    std::uint32_t position_;
+}; // class FeatureExtractor
+
+//------------------------------------------------------------------------------
+#endif // featureExtraction_hpp
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// heapHooks.cpp
+/// -------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "heapHooks.hpp"
+
+#if LE_EXAMPLE_HEAP_HOOKS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#endif // LE_EXAMPLE_HEAP_HOOKS
+//------------------------------------------------------------------------------
+
+#if LE_EXAMPLE_HEAP_HOOKS
+
+namespace
+{
+    thread_local bool realtime = false;
+
+    std::atomic<std::uint32_t> realtimeAccesses( 0 );
+} // anonymous namespace
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Realtime checks
+////////////////////////////////////////////////////////////////////////////////
+
+RealtimeHeapScope:: RealtimeHeapScope() : wasRealtime_( realtime ) { realtime = true; }
+RealtimeHeapScope::~RealtimeHeapScope() { realtime = wasRealtime_; }
+
+std::uint32_t realtimeHeapAccesses() { return realtimeAccesses.load( std::memory_order_relaxed ); }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Global operator new/delete replacements
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    void * hookedAllocate( std::size_t const size ) noexcept
+    {
+        if ( realtime )
+            realtimeAccesses.fetch_add( 1, std::memory_order_relaxed );
+        return std::malloc( size ? size : 1 );
+    }
+
+    void hookedFree( void * const pointer ) noexcept
+    {
+        if ( !pointer )
+            return;
+        if ( realtime )
+            realtimeAccesses.fetch_add( 1, std::memory_order_relaxed );
+        std::free( pointer );
+    }
+
+    void * throwingAllocate( std::size_t const size )
+    {
+        auto const pointer( hookedAllocate( size ) );
+        if ( !pointer )
+        {
+        #ifdef __cpp_exceptions
+            throw std::bad_alloc();
+        #else
+            std::abort();
+        #endif // __cpp_exceptions
+        }
+        return pointer;
+    }
+} // anonymous namespace
+
+void * operator new  ( std::size_t const size                         ) { return throwingAllocate( size ); }
+void * operator new[]( std::size_t const size                         ) { return throwingAllocate( size ); }
+void * operator new  ( std::size_t const size, std::nothrow_t const & ) noexcept { return hookedAllocate( size ); }
+void * operator new[]( std::size_t const size, std::nothrow_t const & ) noexcept { return hookedAllocate( size ); }
+
+void operator delete  ( void * const pointer                         ) noexcept { hookedFree( pointer ); }
+void operator delete[]( void * const pointer                         ) noexcept { hookedFree( pointer ); }
+void operator delete  ( void * const pointer, std::nothrow_t const & ) noexcept { hookedFree( pointer ); }
+void operator delete[]( void * const pointer, std::nothrow_t const & ) noexcept { hookedFree( pointer ); }
+void operator delete  ( void * const pointer, std::size_t            ) noexcept { hookedFree( pointer ); }
+void operator delete[]( void * const pointer, std::size_t            ) noexcept { hookedFree( pointer ); }
+
+#else // LE_EXAMPLE_HEAP_HOOKS
+
+std::uint32_t realtimeHeapAccesses() { return 0; }
+
+#endif // LE_EXAMPLE_HEAP_HOOKS
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// heapHooks.hpp
+/// -------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef heapHooks_hpp__95105A6E_9ACB_459F_8295_8F5542880259
+#define heapHooks_hpp__95105A6E_9ACB_459F_8295_8F5542880259
+#pragma once
+//------------------------------------------------------------------------------
+#include <cstdint>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Heap hooks
+// ----------
+//
+// A debugging aid for verifying that the audio thread never touches the heap.
+// The SDK allocates with the global operator new (from within the prebuilt SDK
+// libraries which get linked into this shared library) so the only way to
+// observe its allocations is to replace the global operator new/delete for
+// the whole app library. As that is too intrusive for regular builds the
+// hooks are an explicit opt-in: build with LE_EXAMPLE_HEAP_HOOKS=1 (e.g. add
+// -DLE_EXAMPLE_HEAP_HOOKS=1 to LOCAL_CFLAGS in Android.mk). Without them
+// RealtimeHeapScope does nothing and the realtime checks always report zero.
+//
+// Note: this only covers memory obtained through operator new (which is what
+// the C++ SDK code uses), not direct malloc() calls.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LE_EXAMPLE_HEAP_HOOKS
+    #define LE_EXAMPLE_HEAP_HOOKS 0
+#endif // LE_EXAMPLE_HEAP_HOOKS
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// RealtimeHeapScope
+// -----------------
+//
+// Marks the current thread as realtime for the lifetime of the scope object:
+// any operator new/delete call made in the meantime is counted (see
+// realtimeHeapAccesses()). Use it around ModuleProcessor::process() calls (or
+// the whole audio callback) to verify that no heap access happens there.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class RealtimeHeapScope
+{
+public:
+#if LE_EXAMPLE_HEAP_HOOKS
+     RealtimeHeapScope();
+    ~RealtimeHeapScope();
+private:
+    bool const wasRealtime_;
+#else
+     RealtimeHeapScope() {}
+#endif // LE_EXAMPLE_HEAP_HOOKS
+}; // class RealtimeHeapScope
+
+// Total number of heap accesses made within RealtimeHeapScopes (by all
+// threads).
+std::uint32_t realtimeHeapAccesses();
+
+//------------------------------------------------------------------------------
+#endif // heapHooks_hpp
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// lockFreeQueue.hpp
+/// -----------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef lockFreeQueue_hpp__2608DC15_C047_485C_9F44_BE2598E5C849
+#define lockFreeQueue_hpp__2608DC15_C047_485C_9F44_BE2598E5C849
+#pragma once
+//------------------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// SPSCQueue
+// ---------
+//
+// A fixed capacity, wait-free, single-producer/single-consumer FIFO used to
+// hand data over to/from the audio thread (no allocation, no locking, push()
+// and pop() never block but rather fail if the queue is full or empty).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, std::uint32_t capacity>
+class SPSCQueue
+{
+    static_assert( capacity && !( capacity & ( capacity - 1 ) ), "Capacity must be a power of two" );
+
+public:
+    SPSCQueue() : head_( 0 ), tail_( 0 ) {}
+
+    // Producer side.
+    bool push( T const & value )
+    {
+        auto const tail( tail_.load( std::memory_order_relaxed ) );
+        if ( tail - head_.load( std::memory_order_acquire ) == capacity )
+            return false;
+        items_[ tail & ( capacity - 1 ) ] = value;
+        tail_.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+
+    // Consumer side.
+    T const * front() const
+    {
+        auto const head( head_.load( std::memory_order_relaxed ) );
+        if ( head == tail_.load( std::memory_order_acquire ) )
+            return nullptr;
+        return &items_[ head & ( capacity - 1 ) ];
+    }
+
+    void popFront() { head_.store( head_.load( std::memory_order_relaxed ) + 1, std::memory_order_release ); }
+
+    bool pop( T & value )
+    {
+        auto const pFront( front() );
+        if ( !pFront )
+            return false;
+        value = *pFront;
+        popFront();
+        return true;
+    }
+
+    // Either side (approximate when called from the 'other' side).
+    bool empty() const { return head_.load( std::memory_order_acquire ) == tail_.load( std::memory_order_acquire ); }
+
+private:
+    SPSCQueue( SPSCQueue const & ) = delete;
+    void operator=( SPSCQueue const & ) = delete;
+
+private:
+    // Keep the producer and consumer indices on separate cache lines (padding
+    // rather than alignas so that instances can be heap allocated in C++14).
+    struct Index : std::atomic<std::uint32_t>
+    {
+        Index( std::uint32_t const value ) : std::atomic<std::uint32_t>( value ) {}
+        char padding[ 64 - sizeof( std::atomic<std::uint32_t> ) ];
+    }; // struct Index
+
+    Index head_;
+    Index tail_;
+    T     items_[ capacity ];
+}; // class SPSCQueue
+
+//------------------------------------------------------------------------------
+#endif // lockFreeQueue_hpp
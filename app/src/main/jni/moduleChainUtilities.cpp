@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// moduleChainUtilities.cpp
+/// ------------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "moduleChainUtilities.hpp"
+
+#include <le/parameters/lfo.hpp>
+#include <le/spectrumworx/engine/moduleChain.hpp>
+#include <le/spectrumworx/engine/moduleFactory.hpp>
+
+#include <le/spectrumworx/effects/blender.hpp>
+#include <le/spectrumworx/effects/burrito.hpp>
+#include <le/spectrumworx/effects/colorifer.hpp>
+#include <le/spectrumworx/effects/denoiser.hpp>
+#include <le/spectrumworx/effects/inserter.hpp>
+#include <le/spectrumworx/effects/pitchFollower.hpp>
+#include <le/spectrumworx/effects/slicer.hpp>
+#include <le/spectrumworx/effects/talkingWind.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+using SW::Engine::ModuleBase;
+
+
+namespace
+{
+    template <typename Parameter>
+    std::uint8_t baseParameterIndex() { return ModuleBase::BaseParameters::IndexOf<Parameter>::value; }
+
+    bool modulated( ModuleBase const & module, std::uint8_t const parameterIndex ) { return module.lfo( parameterIndex ).enabled(); }
+} // anonymous namespace
+
+
+bool isActive( ModuleBase const & module )
+{
+    auto const bypass( baseParameterIndex<ModuleBase::Bypass        >() );
+    auto const wet   ( baseParameterIndex<ModuleBase::Wet           >() );
+    auto const start ( baseParameterIndex<ModuleBase::StartFrequency>() );
+    auto const stop  ( baseParameterIndex<ModuleBase::StopFrequency >() );
+
+    if ( module.getParameter( bypass ) != 0 )
+        return false;
+    if ( ( module.getParameter( wet ) <= 0 ) && !modulated( module, wet ) )
+        return false;
+    if
+    (
+        ( module.getParameter( stop ) <= module.getParameter( start ) ) &&
+        !modulated( module, start ) && !modulated( module, stop )
+    )
+        return false;
+    return true;
+}
+
+
+std::uint8_t removeInactiveModules( SW::Engine::ModuleProcessor & processor )
+{
+    auto & chain( processor.moduleChain() );
+    std::uint8_t removed( 0 );
+    for ( std::uint8_t index( 0 ); index < chain.size(); )
+    {
+        auto & module( chain[ index ] );
+        if ( isActive( module ) )
+        {
+            ++index;
+            continue;
+        }
+        chain.remove( module ); // destroys the module (nothing else references it)
+        ++removed;
+    }
+    return removed;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Side channel
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Effects that always read the side channel. The ones in the first line
+    // declare it (usesSideChannel), the others read it even though their
+    // declaration says otherwise.
+    char const * const sideChannelEffects[] =
+    {
+        "Blender", "Burrito", "Colorifer", "Inserter", "PitchFollower", "PitchFollowerPVD", "TalkingWind",
+        "Convolver", "Ethereal", "Merger", "Shapeless", "SumoPitch", "Vaxateer"
+    };
+
+    // Only checks the entries that have a usesSideChannel declaration to check
+    // against: it cannot detect effects missing from the list.
+    static_assert
+    (
+        SW::Effects::Blender         ::usesSideChannel &&
+        SW::Effects::Burrito         ::usesSideChannel &&
+        SW::Effects::Colorifer       ::usesSideChannel &&
+        SW::Effects::Inserter        ::usesSideChannel &&
+        SW::Effects::PitchFollower   ::usesSideChannel &&
+        SW::Effects::PitchFollowerPVD::usesSideChannel &&
+        SW::Effects::TalkingWind     ::usesSideChannel,
+        "Side channel effect list out of date"
+    );
+
+    bool is( ModuleBase const & module, char const * const effectName ) { return std::strcmp( module.effectName(), effectName ) == 0; }
+
+    // Whether the <Parameter> enumeration of <module> is or, when driven by an
+    // enabled LFO, can be <value>.
+    template <class Effect, class Parameter>
+    bool canBe( ModuleBase const & module, typename Parameter::value_type const value )
+    {
+        auto const index( SW::Engine::Module<Effect>::template parameterIndex<Parameter>() );
+        return modulated( module, index ) || static_cast<unsigned>( module.getParameter( index ) ) == value;
+    }
+} // anonymous namespace
+
+
+bool usesSideChannel( ModuleBase const & module )
+{
+    using namespace SW::Effects;
+
+    for ( auto const effectName : sideChannelEffects )
+    {
+        if ( is( module, effectName ) )
+            return true;
+    }
+    // Effects that read the side channel only in some of their modes.
+    if ( is( module, "Denoiser" ) )
+        return canBe<Denoiser, Denoiser::Mode>( module, Denoiser::Mode::Side ) || canBe<Denoiser, Denoiser::Mode>( module, Denoiser::Mode::Sum );
+    if ( is( module, "Slicer" ) )
+        return canBe<Slicer, Slicer::Mode>( module, Slicer::Mode::Side );
+    return false;
+}
+
+
+bool sideChannelRequired( SW::Engine::ModuleProcessor const & processor )
+{
+    auto const & chain( processor.moduleChain() );
+    for ( std::uint8_t index( 0 ); index < chain.size(); ++index )
+    {
+        auto const & module( chain[ index ] );
+        if ( usesSideChannel( module ) && isActive( module ) )
+            return true;
+    }
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Cloning
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    void copyLFO( Parameters::LFO const & source, Parameters::LFO & target )
+    {
+        // Sync types first (they constrain the period), the upper bound is
+        // opened up first so that setting the lower bound cannot clamp it.
+        target.removeSyncType    ( Parameters::LFO::All );
+        target.addSyncType       ( static_cast<Parameters::LFO::SyncType>( source.syncTypes() ) );
+        target.setPeriodInSeconds( source.period    () );
+        target.setPhase          ( source.phase     () );
+        target.setWaveform       ( source.waveForm  () );
+        target.setUpperBound     ( 1                   );
+        target.setLowerBound     ( source.lowerBound() );
+        target.setUpperBound     ( source.upperBound() );
+        target.setEnabled        ( source.enabled   () );
+    }
+} // anonymous namespace
+
+
+SW::Engine::ModulePtr cloneModule( ModuleBase const & source )
+{
+    auto const pClone( ModuleBase::create( source.effectName() ) );
+    if ( !pClone )
+        return pClone;
+    for ( std::uint8_t parameter( 0 ); parameter < source.numberOfParameters(); ++parameter )
+        pClone->setParameter( parameter, source.getParameter( parameter ) );
+    // All parameters except Bypass (the first one) can be LFO-ed.
+    for ( std::uint8_t parameter( ModuleBase::numberOfNonLFOBaseParameters ); parameter < source.numberOfParameters(); ++parameter )
+        copyLFO( source.lfo( parameter ), pClone->lfo( parameter ) );
+    return pClone;
+}
+
+
+bool copyModuleChain( SW::Engine::ModuleProcessor const & source, SW::Engine::ModuleProcessor & target )
+{
+    auto const & sourceChain( source.moduleChain() );
+    auto       & targetChain( target.moduleChain() );
+    targetChain.clear();
+    for ( std::uint8_t index( 0 ); index < sourceChain.size(); ++index )
+    {
+        auto const pClone( cloneModule( sourceChain[ index ] ) );
+        if ( !pClone || !targetChain.append( pClone ) )
+            return false;
+    }
+    return true;
+}
+
+
+bool copyProcessorSetup( SW::Engine::ModuleProcessor const & source, SW::Engine::ModuleProcessor & target )
+{
+    if
+    (
+        !target.setEngineParameters
+        (
+            source.numberOfChannels       (),
+            source.sampleRate             (),
+            source.fftSize                (),
+            source.windowOverlappingFactor(),
+            source.windowFunction         ()
+        )
+    )
+        return false;
+    target.setGain   ( source.gain   () );
+    target.setWetness( source.wetness() );
+    return copyModuleChain( source, target );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ActiveModuleChain
+////////////////////////////////////////////////////////////////////////////////
+
+void ActiveModuleChain::attach( SW::Engine::ModuleProcessor & processor )
+{
+    detach();
+    pProcessor_ = &processor;
+    auto & chain( processor.moduleChain() );
+    modules_.reserve( chain.size() ); // errchk
+    for ( std::uint8_t index( 0 ); index < chain.size(); ++index )
+    {
+        AuthoredModule const module = { SW::Engine::ModulePtr( &chain[ index ] ), true };
+        modules_.push_back( module );
+    }
+}
+
+
+void ActiveModuleChain::detach()
+{
+    if ( !pProcessor_ )
+        return;
+    synchronise( true );
+    modules_.clear();
+    pProcessor_ = nullptr;
+}
+
+
+std::uint8_t ActiveModuleChain::update() { return synchronise( false ); }
+
+
+std::uint8_t ActiveModuleChain::synchronise( bool const includeInactiveModules )
+{
+    assert( pProcessor_ );
+    auto & chain( pProcessor_->moduleChain() );
+    // Catches chains modified behind our back (or a processor destroyed
+    // before detach(), see the class description) in debug builds.
+    assert( static_cast<std::ptrdiff_t>( chain.size() ) == std::count_if( modules_.begin(), modules_.end(), []( AuthoredModule const & module ) { return module.inChain; } ) );
+    ModuleBase * pPrecedingModule( nullptr );
+    std::uint8_t numberOfModulesInChain( 0 );
+    for ( auto & module : modules_ )
+    {
+        bool const wanted( includeInactiveModules || isActive( *module.pModule ) );
+        if ( wanted && !module.inChain )
+        {
+            module.inChain = pPrecedingModule
+                ? chain.insertAfter( *pPrecedingModule, *module.pModule )
+                : chain.prepend    (                    *module.pModule );
+        }
+        else
+        if ( !wanted && module.inChain )
+        {
+            chain.remove( *module.pModule ); // still kept alive by modules_
+            module.inChain = false;
+        }
+        if ( module.inChain )
+        {
+            pPrecedingModule = module.pModule.get();
+            ++numberOfModulesInChain;
+        }
+    }
+    return numberOfModulesInChain;
+}
+
+//------------------------------------------------------------------------------
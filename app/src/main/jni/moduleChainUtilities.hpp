@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// moduleChainUtilities.hpp
+/// ------------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef moduleChainUtilities_hpp__98B76A89_259C_468D_B97E_F2473EB336BE
+#define moduleChainUtilities_hpp__98B76A89_259C_468D_B97E_F2473EB336BE
+#pragma once
+//------------------------------------------------------------------------------
+#include <le/spectrumworx/engine/moduleBase.hpp>
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+
+#include <cstdint>
+#include <vector>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Module activity
+// ---------------
+//
+// A module cannot affect the output signal if it is bypassed, fully dry
+// (Wet = 0) or if its frequency range is empty (StopFrequency <=
+// StartFrequency) - unless the Wet or frequency range parameters are driven by
+// an enabled LFO. The engine gives no guarantees about the cost of such modules
+// (it still has to run each module's setup and, depending on the effect, its
+// bin loops) so the helpers below take them out of the processor's chain
+// altogether.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool isActive( LE::SW::Engine::ModuleBase const & );
+
+// One-shot version for static setups (e.g. right after loadPreset() when the
+// module parameters are not changed afterwards): removes the inactive modules
+// from <processor>'s chain and returns the number of removed modules.
+std::uint8_t removeInactiveModules( LE::SW::Engine::ModuleProcessor & processor );
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Side channel
+// ------------
+//
+// Some effects read the side channel passed to ModuleProcessor::process():
+// Blender, Burrito, Colorifer, Convolver, Ethereal, Inserter, Merger,
+// PitchFollower(PVD), Shapeless, SumoPitch, TalkingWind and Vaxateer always,
+// Denoiser (Side and Sum modes) and Slicer (Side mode) depending on their
+// Mode. Several of them do not declare it (their usesSideChannel is false).
+// When none of the active modules in a chain reads the side channel the side
+// signal is not needed at all so callers can skip producing it (e.g. reading
+// or decoding a side chain file) and pass no side channel to the processor
+// (which then also skips its side channel framing and analysis).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool usesSideChannel( LE::SW::Engine::ModuleBase const & );
+
+// Whether any active (see isActive()) module in <processor>'s chain uses the
+// side channel. Cheap enough to be called for every processed block (e.g. to
+// follow parameter changes that bypass modules).
+bool sideChannelRequired( LE::SW::Engine::ModuleProcessor const & processor );
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Cloning
+// -------
+//
+// ModuleProcessor and ModuleBase instances are not copyable: these helpers
+// recreate an equivalent setup (effects, parameter values and LFO settings;
+// but not the runtime/signal state) in a different processor. They allocate
+// and are meant for the control thread (they only read from the source so
+// the source may be processing concurrently).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+LE::SW::Engine::ModulePtr cloneModule( LE::SW::Engine::ModuleBase const & );
+
+// Replaces <target>'s chain with clones of the modules in <source>'s chain.
+bool copyModuleChain   ( LE::SW::Engine::ModuleProcessor const & source, LE::SW::Engine::ModuleProcessor & target );
+// Engine parameters, gain, wetness and the module chain.
+bool copyProcessorSetup( LE::SW::Engine::ModuleProcessor const & source, LE::SW::Engine::ModuleProcessor & target );
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// ActiveModuleChain
+// -----------------
+//
+// Keeps the 'authored' module chain of a processor (e.g. as loaded from a
+// preset) and, on each call to update(), synchronises the processor's actual
+// chain so that it contains only the currently active modules, in the
+// authored order. Modules are kept alive (with their parameter values) while
+// they are out of the chain.
+//
+// Inserting modules into a chain allocates memory (and resets the state of
+// the inserted module) so update() has to be called from the control thread
+// and, like any other chain modification, must not overlap with
+// ModuleProcessor::process().
+//
+// The processor is referenced, not owned (it is often the singleton or a
+// member of the owner): it has to outlive the attachment, i.e. call detach()
+// (or destroy the ActiveModuleChain) before the processor is destroyed. The
+// processor's chain must not be modified by other code while attached.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class ActiveModuleChain
+{
+public:
+    ActiveModuleChain() : pProcessor_( nullptr ) {}
+    ~ActiveModuleChain() { detach(); }
+
+    // Takes the current contents of <processor>'s chain as the authored chain
+    // (see above for the lifetime requirements).
+    void attach( LE::SW::Engine::ModuleProcessor & processor );
+    // Restores the complete authored chain.
+    void detach();
+
+    // Returns the number of active modules.
+    std::uint8_t update();
+
+    std::uint8_t                 numberOfModules() const { return static_cast<std::uint8_t>( modules_.size() ); }
+    LE::SW::Engine::ModuleBase & module( std::uint8_t const index ) { return *modules_[ index ].pModule; }
+
+private:
+    ActiveModuleChain( ActiveModuleChain const & ) = delete;
+    void operator=( ActiveModuleChain const & ) = delete;
+
+    std::uint8_t synchronise( bool includeInactiveModules );
+
+    struct AuthoredModule
+    {
+        LE::SW::Engine::ModulePtr pModule;
+        bool                      inChain;
+    }; // struct AuthoredModule
+
+private:
+    LE::SW::Engine::ModuleProcessor * pProcessor_;
+    std::vector<AuthoredModule>       modules_   ;
+}; // class ActiveModuleChain
+
+//------------------------------------------------------------------------------
+#endif // moduleChainUtilities_hpp
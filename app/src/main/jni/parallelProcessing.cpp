@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// parallelProcessing.cpp
+/// ----------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "parallelProcessing.hpp"
+
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+
+#include <le/utility/trace.hpp>
+
+#include <algorithm>
+#include <cassert>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// WorkerPool
+////////////////////////////////////////////////////////////////////////////////
+
+WorkerPool::WorkerPool( std::uint8_t numberOfThreads )
+    :
+    job_         ( ~std::uint64_t( 0 ) & 0xFFFFFFFF ), // generation 0, everything claimed
+    pendingTasks_( 0       ),
+    pFunction_   ( nullptr ),
+    pContext_    ( nullptr ),
+    running_     ( true    ),
+    busy_        ( false   )
+{
+    if ( !numberOfThreads )
+    {
+        auto const cores( std::thread::hardware_concurrency() );
+        numberOfThreads = static_cast<std::uint8_t>( std::min( std::max( cores, 1U ) - 1, 32U ) );
+    }
+    for ( std::uint8_t thread( 0 ); thread < numberOfThreads; ++thread )
+        threads_.emplace_back( &WorkerPool::workerLoop, this ); // errchk
+}
+
+
+WorkerPool::~WorkerPool()
+{
+    {
+        // (under the lock so that no worker can miss the stop request)
+        std::lock_guard<std::mutex> const lock( mutex_ );
+        running_ = false;
+    }
+    jobReady_.notify_all();
+    for ( auto & thread : threads_ )
+        thread.join();
+}
+
+
+void WorkerPool::run( std::uint8_t const numberOfTasks, TaskFunction const pFunction, void * const pContext )
+{
+    // In both cases below the job cannot be published: stay correct
+    // (serially, on the calling thread) rather than parallel.
+    auto const runSerially
+    (
+        [ = ]()
+        {
+            for ( std::uint8_t taskIndex( 0 ); taskIndex < numberOfTasks; ++taskIndex )
+                pFunction( pContext, taskIndex );
+        }
+    );
+
+    if ( numberOfTasks > maximumNumberOfTasks )
+    {
+        // The claimed tasks mask cannot describe the job.
+        Utility::Tracer::error( "WorkerPool: %u tasks exceed the maximum (%u), running serially.", numberOfTasks, maximumNumberOfTasks );
+        runSerially();
+        return;
+    }
+
+    if ( busy_.exchange( true, std::memory_order_acquire ) )
+    {
+        // Another thread's job is in progress (see the class description).
+        Utility::Tracer::error( "WorkerPool: concurrent run() calls, running serially." );
+        runSerially();
+        return;
+    }
+    assert( pendingTasks_ == 0 );
+
+    // The previous job has completed so no worker can be touching the job
+    // data at this point.
+    pFunction_ = pFunction;
+    pContext_  = pContext ;
+    pendingTasks_.store( numberOfTasks, std::memory_order_relaxed );
+
+    auto const generation       ( ( job_.load( std::memory_order_relaxed ) >> 32 ) + 1 );
+    auto const nonExistingTasks ( static_cast<std::uint32_t>( ~( ( std::uint64_t( 1 ) << numberOfTasks ) - 1 ) ) );
+    job_.store( ( generation << 32 ) | nonExistingTasks, std::memory_order_release );
+    // The calling thread takes one of the tasks itself.
+    auto const workersToWake( std::min<std::size_t>( numberOfTasks ? numberOfTasks - 1 : 0, threads_.size() ) );
+    for ( std::size_t worker( 0 ); worker < workersToWake; ++worker )
+        jobReady_.notify_one();
+
+    runPendingTasks();
+
+    while ( pendingTasks_.load( std::memory_order_acquire ) )
+        std::this_thread::yield();
+
+    busy_.store( false, std::memory_order_release );
+}
+
+
+bool WorkerPool::runPendingTasks()
+{
+    bool ranAny( false );
+    auto job( job_.load( std::memory_order_acquire ) );
+    for ( ; ; )
+    {
+        auto const claimedTasks( static_cast<std::uint32_t>( job ) );
+        if ( claimedTasks == 0xFFFFFFFF )
+            return ranAny;
+        std::uint8_t taskIndex( 0 );
+        while ( claimedTasks & ( 1U << taskIndex ) )
+            ++taskIndex;
+        // The generation is part of the CAS-ed value so a task can only ever
+        // be claimed from the job it was published with.
+        if ( job_.compare_exchange_weak( job, job | ( 1U << taskIndex ), std::memory_order_acq_rel, std::memory_order_acquire ) )
+        {
+            pFunction_( pContext_, taskIndex );
+            pendingTasks_.fetch_sub( 1, std::memory_order_release );
+            ranAny = true;
+            job = job_.load( std::memory_order_acquire );
+        }
+    }
+}
+
+
+void WorkerPool::workerLoop()
+{
+    auto const hasPendingTasks( [ this ]() { return static_cast<std::uint32_t>( job_.load( std::memory_order_acquire ) ) != 0xFFFFFFFF; } );
+    while ( running_.load( std::memory_order_relaxed ) )
+    {
+        if ( runPendingTasks() )
+            continue;
+
+        // Idle workers sleep until the next job (no polling). The producer
+        // (the audio thread) never takes the mutex so a worker that is just
+        // about to wait can miss a notification: it then sits out that one
+        // job (the caller runs the tasks itself) and is woken by the next
+        // one. The stop request is made under the lock so it is never missed.
+        std::unique_lock<std::mutex> lock( mutex_ );
+        jobReady_.wait( lock, [ & ]() { return hasPendingTasks() || !running_.load( std::memory_order_relaxed ); } );
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ParallelChannelProcessor
+////////////////////////////////////////////////////////////////////////////////
+
+ParallelChannelProcessor::ParallelChannelProcessor( WorkerPool * const pSharedPool )
+    :
+    pOwnPool_( pSharedPool ? nullptr : new WorkerPool ), // errchk
+    pool_    ( pSharedPool ? *pSharedPool : *pOwnPool_ )
+{}
+
+
+bool ParallelChannelProcessor::createChannelProcessors( std::uint8_t const numberOfChannels )
+{
+    processors_.clear();
+    if ( numberOfChannels > WorkerPool::maximumNumberOfTasks )
+    {
+        Utility::Tracer::error( "At most %u channels can be processed in parallel.", WorkerPool::maximumNumberOfTasks );
+        return false;
+    }
+    for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+    {
+        auto pProcessor( SW::Engine::ModuleProcessor::create() );
+        if ( !pProcessor )
+            return false;
+        processors_.push_back( std::move( pProcessor ) ); // errchk
+    }
+    return true;
+}
+
+
+void ParallelChannelProcessor::reset()
+{
+    for ( auto const & pProcessor : processors_ )
+        pProcessor->reset();
+}
+
+
+void ParallelChannelProcessor::process
+(
+    float const * const * const inputs,
+    float const * const * const sideInputs,
+    float       * const * const outputs,
+    std::uint32_t         const sampleFrames
+)
+{
+    auto channelTask
+    (
+        [ = ]( std::uint8_t const channel )
+        {
+            processors_[ channel ]->process
+            (
+                &inputs [ channel ],
+                sideInputs ? &sideInputs[ channel ] : nullptr,
+                &outputs[ channel ],
+                sampleFrames
+            );
+        }
+    );
+    pool_.run( numberOfChannels(), channelTask );
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// parallelProcessing.hpp
+/// ----------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef parallelProcessing_hpp__FAF2F462_3F10_4E1F_95B2_A2E5BB33FC94
+#define parallelProcessing_hpp__FAF2F462_3F10_4E1F_95B2_A2E5BB33FC94
+#pragma once
+//------------------------------------------------------------------------------
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+#include <le/utility/filesystem.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Multi-core execution helpers built on top of the public ModuleProcessor API.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// WorkerPool
+// ----------
+//
+// A minimal fork-join thread pool suitable for use from the audio thread:
+// run() publishes a job (an indexed set of independent tasks) without locking
+// or allocating, executes tasks on the calling thread as well and returns once
+// all the tasks have completed. Tasks are claimed individually so a worker
+// that is late to wake up never delays the caller (the caller simply claims
+// the remaining tasks itself). Idle workers sleep on a condition variable
+// (they do not poll) so an idle pool costs no CPU and each job wakes only as
+// many of them as it has tasks for.
+//
+// A pool runs one job at a time: run() must not be called from more than one
+// thread at once. A pool shared by several users (e.g. a
+// ParallelChannelProcessor and a PresetPreviewRenderer) therefore has to be
+// driven from a single thread (e.g. the one audio callback). A run() that
+// overlaps with another one is detected, logged and executed serially on its
+// calling thread (correct but not parallel) rather than corrupting the job in
+// progress.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class WorkerPool
+{
+public:
+    // Jobs with more tasks are run serially on the calling thread.
+    static std::uint8_t const maximumNumberOfTasks = 32;
+
+    // Zero threads = one less than the number of available cores (the calling
+    // thread is the remaining worker).
+    explicit WorkerPool( std::uint8_t numberOfThreads = 0 );
+            ~WorkerPool();
+
+    std::uint8_t numberOfThreads() const { return static_cast<std::uint8_t>( threads_.size() ); }
+
+    template <typename Task>
+    void run( std::uint8_t const numberOfTasks, Task & task )
+    {
+        run( numberOfTasks, &invoke<Task>, &task );
+    }
+
+private:
+    typedef void ( * TaskFunction )( void * context, std::uint8_t taskIndex );
+
+    template <typename Task>
+    static void invoke( void * const pTask, std::uint8_t const taskIndex ) { ( *static_cast<Task *>( pTask ) )( taskIndex ); }
+
+    void run( std::uint8_t numberOfTasks, TaskFunction, void * context );
+
+    bool runPendingTasks();
+    void workerLoop     ();
+
+private:
+    // High 32 bits: job generation, low 32 bits: claimed tasks mask.
+    std::atomic<std::uint64_t> job_         ;
+    std::atomic<std::uint32_t> pendingTasks_;
+    TaskFunction               pFunction_   ;
+    void                     * pContext_    ;
+
+    std::atomic<bool>          running_     ;
+    std::atomic<bool>          busy_        ; // a run() is in progress
+    std::mutex                 mutex_       ;
+    std::condition_variable    jobReady_    ;
+    std::vector<std::thread>   threads_     ;
+}; // class WorkerPool
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// ParallelChannelProcessor
+// ------------------------
+//
+// Processes each channel of a multichannel stream with its own, identically
+// setup, mono ModuleProcessor and spreads the channels across a WorkerPool
+// (either a shared, user supplied one or one owned by the processor).
+// Because every channel always goes through the same ModuleProcessor instance
+// the result is bit-identical to processing the channels serially, regardless
+// of which thread processes which channel. This obviously does not apply to
+// setups in which effects are expected to link channels.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class ParallelChannelProcessor
+{
+public:
+    explicit ParallelChannelProcessor( WorkerPool * pSharedPool = nullptr );
+
+    template <LE::Utility::SpecialLocations rootLocation>
+    bool loadPreset( char const * const presetFile, std::uint8_t const numberOfChannels, std::uint32_t const sampleRate )
+    {
+        if ( !createChannelProcessors( numberOfChannels ) )
+            return false;
+        for ( auto const & pProcessor : processors_ )
+        {
+            if ( !pProcessor->setAudioFormat( 1, sampleRate ) || !pProcessor->loadPreset<rootLocation>( presetFile ) )
+                return false;
+        }
+        return true;
+    }
+
+    std::uint8_t                      numberOfChannels() const { return static_cast<std::uint8_t>( processors_.size() ); }
+    LE::SW::Engine::ModuleProcessor & channelProcessor( std::uint8_t const channel ) { return *processors_[ channel ]; }
+
+    void reset();
+
+    // Audio thread: separated channels, optional side chain.
+    void process( float const * const * inputs, float const * const * sideInputs, float * const * outputs, std::uint32_t sampleFrames );
+    void process( float * const * inputsAndOutputs, std::uint32_t sampleFrames ) { process( inputsAndOutputs, nullptr, inputsAndOutputs, sampleFrames ); }
+
+private:
+    bool createChannelProcessors( std::uint8_t numberOfChannels );
+
+private:
+    std::unique_ptr<WorkerPool>                     pOwnPool_  ;
+    WorkerPool                                    & pool_      ;
+    std::vector<LE::SW::Engine::ModuleProcessorPtr> processors_;
+}; // class ParallelChannelProcessor
+
+//------------------------------------------------------------------------------
+#endif // parallelProcessing_hpp
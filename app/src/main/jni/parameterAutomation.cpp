@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// parameterAutomation.cpp
+/// -----------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "parameterAutomation.hpp"
+
+#include <le/parameters/runtimeInformation.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+
+
+ParameterAutomation::ParameterAutomation()
+    :
+    pProcessor_   ( nullptr ),
+    position_     ( 0       ),
+    numberOfRamps_( 0       ),
+    lastRampStep_ ( 0       )
+{}
+
+
+void ParameterAutomation::attach( SW::Engine::ModuleProcessor & processor )
+{
+    Event discarded;
+    while ( events_.pop( discarded ) ) {}
+    numberOfRamps_ = 0;
+    rampTimes_.clear();
+
+    pProcessor_ = &processor;
+    pProcessor_->reset(); // align the step grid with the stream position
+    position_.store( 0, std::memory_order_release );
+    lastRampStep_ = std::numeric_limits<std::uint64_t>::max();
+}
+
+
+void ParameterAutomation::setRampTime( SW::Engine::ModuleBase & module, std::uint8_t const parameterIndex, float const milliseconds )
+{
+    auto const frames( static_cast<std::uint32_t>( milliseconds * pProcessor_->sampleRate() / 1000 ) );
+    for ( auto & rampTime : rampTimes_ )
+    {
+        if ( rampTime.pModule == &module && rampTime.parameterIndex == parameterIndex )
+        {
+            rampTime.frames = frames;
+            return;
+        }
+    }
+    RampTime const rampTime = { &module, frames, parameterIndex };
+    rampTimes_.push_back( rampTime ); // errchk
+}
+
+
+bool ParameterAutomation::post( SW::Engine::ModuleBase & module, std::uint8_t const parameterIndex, float const value, std::uint64_t const samplePosition, std::uint32_t const rampFrames )
+{
+    assert( parameterIndex < module.numberOfParameters() );
+    Event const event = { samplePosition, &module, value, rampFrames, parameterIndex };
+    return events_.push( event );
+}
+
+
+bool ParameterAutomation::post( SW::Engine::ModuleBase & module, std::uint8_t const parameterIndex, float const value, std::uint64_t const samplePosition )
+{
+    std::uint32_t rampFrames( 0 );
+    for ( auto const & rampTime : rampTimes_ )
+    {
+        if ( rampTime.pModule == &module && rampTime.parameterIndex == parameterIndex )
+            rampFrames = rampTime.frames;
+    }
+    return post( module, parameterIndex, value, samplePosition, rampFrames );
+}
+
+
+std::uint64_t ParameterAutomation::applyDueEvents( std::uint64_t const position )
+{
+    auto const stepSize ( pProcessor_->stepSize() );
+    auto const stepIndex( position / stepSize );
+    auto const stepEnd  ( ( stepIndex + 1 ) * stepSize );
+    auto       nextEvent( std::numeric_limits<std::uint64_t>::max() );
+    while ( auto const pEvent = events_.front() )
+    {
+        if ( pEvent->position >= stepEnd )
+        {
+            nextEvent = pEvent->position;
+            break;
+        }
+        startRamp( *pEvent, stepIndex == lastRampStep_ );
+        events_.popFront();
+    }
+    // Once per step.
+    if ( stepIndex != lastRampStep_ )
+    {
+        advanceRamps();
+        lastRampStep_ = stepIndex;
+    }
+    return nextEvent;
+}
+
+
+void ParameterAutomation::startRamp( Event const & event, bool const currentStepAdvanced )
+{
+    // A new change of a parameter replaces its ongoing ramp (if any).
+    Ramp * pRamp( nullptr );
+    for ( std::uint8_t ramp( 0 ); ramp < numberOfRamps_; ++ramp )
+    {
+        if ( ramps_[ ramp ].pModule == event.pModule && ramps_[ ramp ].parameterIndex == event.parameterIndex )
+            pRamp = &ramps_[ ramp ];
+    }
+
+    auto const stepSize( pProcessor_->stepSize() );
+    auto const steps   ( ( event.rampFrames + stepSize - 1 ) / stepSize );
+    if ( steps < 2 || ( !pRamp && numberOfRamps_ == maximumNumberOfRamps ) )
+    {
+        if ( pRamp )
+            *pRamp = ramps_[ --numberOfRamps_ ];
+        event.pModule->setParameter( event.parameterIndex, event.value );
+        return;
+    }
+
+    if ( !pRamp )
+        pRamp = &ramps_[ numberOfRamps_++ ];
+    float const current( event.pModule->getParameter( event.parameterIndex ) );
+    pRamp->pModule        = event.pModule;
+    pRamp->parameterIndex = event.parameterIndex;
+    pRamp->value          = current;
+    pRamp->target         = event.value;
+    pRamp->increment      = ( event.value - current ) / steps;
+    pRamp->stepsLeft      = steps;
+    // The first increment is normally applied by advanceRamps() for the
+    // current step, unless that already happened.
+    if ( currentStepAdvanced )
+    {
+        pRamp->value += pRamp->increment;
+        pRamp->stepsLeft--;
+        event.pModule->setParameter( event.parameterIndex, pRamp->value );
+    }
+}
+
+
+void ParameterAutomation::advanceRamps()
+{
+    for ( std::uint8_t ramp( 0 ); ramp < numberOfRamps_; )
+    {
+        auto & state( ramps_[ ramp ] );
+        state.value = ( --state.stepsLeft ) ? state.value + state.increment : state.target;
+        state.pModule->setParameter( state.parameterIndex, state.value );
+        if ( state.stepsLeft )
+            ++ramp;
+        else
+            state = ramps_[ --numberOfRamps_ ];
+    }
+}
+
+
+void ParameterAutomation::flush()
+{
+    // Ramps first: a pending event for the same parameter is the newer value.
+    for ( std::uint8_t ramp( 0 ); ramp < numberOfRamps_; ++ramp )
+        ramps_[ ramp ].pModule->setParameter( ramps_[ ramp ].parameterIndex, ramps_[ ramp ].target );
+    numberOfRamps_ = 0;
+
+    Event event;
+    while ( events_.pop( event ) )
+        event.pModule->setParameter( event.parameterIndex, event.value );
+}
+
+
+float ParameterAutomation::adjustedValue( SW::Engine::ModuleBase const & module, std::uint8_t const parameterIndex, float const value )
+{
+    using Info = SW::Engine::ModuleBase::ParameterInfo;
+    auto const & info( module.parameterInfo( parameterIndex ) );
+    auto const   clamped( std::min( std::max( value, info.minimum ), info.maximum ) );
+    return ( info.type == Info::FloatingPoint ) ? clamped : std::round( clamped );
+}
+
+
+void ParameterAutomation::process( float * pMain, float const * pSide, std::uint32_t sampleFrames )
+{
+    assert( pProcessor_ );
+    auto & processor( *pProcessor_ );
+    auto const stepSize        ( processor.stepSize        () );
+    auto const numberOfChannels( processor.numberOfChannels() );
+    auto       position        ( position_.load( std::memory_order_relaxed ) );
+
+    while ( sampleFrames )
+    {
+        // Process up to the start of the step that contains the next event
+        // (in one go if there is no event in this buffer and no active ramps).
+        // While ramps are active, the buffers have to be split at every step
+        // boundary.
+        auto const nextEvent    ( applyDueEvents( position ) );
+        auto const nextEventStep( nextEvent - ( nextEvent % stepSize ) );
+        auto const nextStep     ( position - ( position % stepSize ) + stepSize );
+        auto const chunkEnd     ( numberOfRamps_ ? std::min( nextEventStep, nextStep ) : nextEventStep );
+        auto const chunkFrames
+        (
+            static_cast<std::uint32_t>( std::min<std::uint64_t>( sampleFrames, chunkEnd - position ) )
+        );
+        assert( chunkFrames );
+
+        if ( pSide )
+            processor.process( pMain, pSide, pMain, chunkFrames );
+        else
+            processor.process( pMain,               chunkFrames );
+
+        pMain        += chunkFrames * numberOfChannels;
+        pSide        += pSide ? chunkFrames * numberOfChannels : 0;
+        sampleFrames -= chunkFrames;
+        position     += chunkFrames;
+    }
+
+    position_.store( position, std::memory_order_release );
+}
+
+//------------------------------------------------------------------------------
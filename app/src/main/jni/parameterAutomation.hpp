@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// parameterAutomation.hpp
+/// -----------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef parameterAutomation_hpp__817CF1F6_F949_420D_ADD7_B5CE664AB4EE
+#define parameterAutomation_hpp__817CF1F6_F949_420D_ADD7_B5CE664AB4EE
+#pragma once
+//------------------------------------------------------------------------------
+#include "lockFreeQueue.hpp"
+
+#include <le/spectrumworx/engine/moduleBase.hpp>
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// ParameterAutomation
+// -------------------
+//
+// Sample-accurate(ish), thread safe parameter automation for a
+// ModuleProcessor.
+//
+// Parameter changes are posted, with a timestamp (an absolute sample frame
+// position in the processed stream), from a single control/automation thread
+// into a lock-free queue and are applied by the audio thread, in between
+// ModuleProcessor::process() calls, so that effects never see their
+// parameters changing while they are processing a frame.
+//
+// The engine reads the parameters once per WOLA step (see the
+// ModuleProcessor::stepSize() documentation) so the finest meaningful
+// resolution is one step: process() splits the incoming buffers at step
+// boundaries, where necessary, so that each event is applied just before the
+// processing of the step that contains its timestamp (regardless of the audio
+// callback size). Events must be posted in non-decreasing timestamp order,
+// late events are applied as soon as possible.
+//
+// Parameter changes can also be ramped: instead of jumping to the new value
+// the audio thread then moves the parameter linearly towards it, in equal
+// increments applied once per step (i.e. at most one setParameter() call per
+// parameter per frame, so derived effect coefficients are recalculated only
+// once per frame), for the configured ramp time. This avoids zipper noise
+// for parameters like pitch or room size without the control thread having to
+// send intermediate values.
+//
+// The modules referenced by queued events (and active ramps) must stay alive
+// (e.g. remain in the chain) until the events are applied (ramps completed).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class ParameterAutomation
+{
+public:
+    ParameterAutomation();
+
+    // Control thread, while not processing: binds to <processor>, resets it
+    // and the stream position and discards any pending events.
+    void attach( LE::SW::Engine::ModuleProcessor & processor );
+
+    // Automation thread: sets the ramp time used by subsequent post() calls
+    // for the given parameter (zero, the default, means no ramping).
+    void setRampTime( LE::SW::Engine::ModuleBase &, std::uint8_t parameterIndex, float milliseconds );
+
+    // Automation thread. Return false if the queue is full.
+    bool post( LE::SW::Engine::ModuleBase &, std::uint8_t parameterIndex, float value, std::uint64_t samplePosition, std::uint32_t rampFrames );
+    bool post( LE::SW::Engine::ModuleBase &, std::uint8_t parameterIndex, float value, std::uint64_t samplePosition );
+    bool post( LE::SW::Engine::ModuleBase & module, std::uint8_t const parameterIndex, float const value ) { return post( module, parameterIndex, value, position() ); }
+
+    // The position (in sample frames) processed so far: the 'now' for the
+    // automation thread.
+    std::uint64_t position() const { return position_.load( std::memory_order_acquire ); }
+
+    // Consumer side (the audio thread or, once the audio thread can no
+    // longer call process(), the control thread, never both): applies all
+    // pending events (and completes active ramps) immediately, so that
+    // changes posted just before processing stopped are not lost.
+    void flush();
+
+    // The value <module> will store for <value> (clamped to the parameter's
+    // range, rounded for non floating point parameters) for reporting queued
+    // changes before they are applied.
+    static float adjustedValue( LE::SW::Engine::ModuleBase const &, std::uint8_t parameterIndex, float value );
+
+    // Audio thread: interleaved, in-place, optional side chain.
+    void process( float * interleavedInputOutput, float const * interleavedSideChain, std::uint32_t sampleFrames );
+    void process( float * interleavedInputOutput,                                     std::uint32_t sampleFrames ) { process( interleavedInputOutput, nullptr, sampleFrames ); }
+
+private:
+    struct Event
+    {
+        std::uint64_t                position      ;
+        LE::SW::Engine::ModuleBase * pModule       ;
+        float                        value         ;
+        std::uint32_t                rampFrames    ;
+        std::uint8_t                 parameterIndex;
+    }; // struct Event
+
+    struct Ramp
+    {
+        LE::SW::Engine::ModuleBase * pModule       ;
+        float                        value         ;
+        float                        target        ;
+        float                        increment     ;
+        std::uint32_t                stepsLeft     ;
+        std::uint8_t                 parameterIndex;
+    }; // struct Ramp
+
+    struct RampTime
+    {
+        LE::SW::Engine::ModuleBase * pModule       ;
+        std::uint32_t                frames        ;
+        std::uint8_t                 parameterIndex;
+    }; // struct RampTime
+
+    static std::uint32_t const queueCapacity         = 4096;
+    static std::uint8_t  const maximumNumberOfRamps  = 64  ;
+
+    // Applies the events that fall into the step starting at <position> (or
+    // earlier) and returns the position of the first pending event (or
+    // UINT64_MAX).
+    std::uint64_t applyDueEvents( std::uint64_t position );
+    void          startRamp     ( Event const &, bool currentStepAdvanced );
+    void          advanceRamps  ();
+
+private:
+    SPSCQueue<Event, queueCapacity>   events_    ;
+    LE::SW::Engine::ModuleProcessor * pProcessor_;
+    std::atomic<std::uint64_t>        position_  ;
+
+    // Audio thread state
+    Ramp          ramps_[ maximumNumberOfRamps ];
+    std::uint8_t  numberOfRamps_;
+    std::uint64_t lastRampStep_ ;
+
+    // Automation thread state
+    std::vector<RampTime> rampTimes_;
+}; // class ParameterAutomation
+
+//------------------------------------------------------------------------------
+#endif // parameterAutomation_hpp
@@ -0,0 +1,210 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// presetBank.cpp
+/// --------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "presetBank.hpp"
+
+#include "engineSetup.hpp"
+#include "moduleChainUtilities.hpp"
+
+#include <le/utility/trace.hpp>
+
+#include <algorithm>
+#include <cstring>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+
+
+PresetBank::PresetBank()
+    :
+    numberOfPresets_ ( 0     ),
+    numberOfChannels_( 0     ),
+    maximumBlockSize_( 0     ),
+    cancelLoading_   ( false ),
+    active_          ( 0     ),
+    target_          ( 0     ),
+    state_           ( Idle  )
+{}
+
+PresetBank::~PresetBank() { clear(); }
+
+
+bool PresetBank::prepare
+(
+    std::vector<std::string> presetFiles,
+    PresetLoader       const loadPreset,
+    std::uint8_t       const numberOfChannels,
+    std::uint32_t      const sampleRate,
+    std::uint16_t      const maximumBlockSize,
+    std::uint16_t      const crossfadeFrames,
+    float              const maximumLatencyInMilliseconds
+)
+{
+    clear();
+
+    auto const numberOfPresets( static_cast<std::uint8_t>( std::min<std::size_t>( presetFiles.size(), 255 ) ) );
+    if ( !numberOfPresets || !maximumBlockSize )
+        return false;
+
+    processors_.reserve( numberOfPresets ); // errchk
+    for ( std::uint8_t preset( 0 ); preset < numberOfPresets; ++preset )
+    {
+        auto pProcessor( SW::Engine::ModuleProcessor::create() );
+        if ( !pProcessor )
+        {
+            processors_.clear();
+            return false;
+        }
+        processors_.push_back( std::move( pProcessor ) );
+    }
+    ready_.reset( new std::atomic<bool>[ numberOfPresets ] ); // errchk
+    for ( std::uint8_t preset( 0 ); preset < numberOfPresets; ++preset )
+        ready_[ preset ].store( false, std::memory_order_relaxed );
+    numberOfPresets_  = numberOfPresets;
+    numberOfChannels_ = numberOfChannels;
+    maximumBlockSize_ = maximumBlockSize;
+    crossfade_.setup( numberOfChannels, maximumBlockSize, crossfadeFrames );
+
+    active_.store( 0   , std::memory_order_relaxed );
+    state_ .store( Idle, std::memory_order_release );
+
+    // Only the loader thread touches a processor until its ready flag is set.
+    cancelLoading_.store( false, std::memory_order_relaxed );
+    loader_ = std::thread
+    (
+        [ = ]( std::vector<std::string> const & files )
+        {
+            for ( std::uint8_t preset( 0 ); preset < numberOfPresets; ++preset )
+            {
+                if ( cancelLoading_.load( std::memory_order_relaxed ) )
+                    return;
+                auto & processor( *processors_[ preset ] );
+                if
+                (
+                    !processor.setAudioFormat( numberOfChannels, sampleRate ) ||
+                    !loadPreset( processor, files[ preset ].c_str() )
+                )
+                {
+                    Utility::Tracer::error( "Failed to load preset %s.", files[ preset ].c_str() );
+                    continue;
+                }
+                removeInactiveModules( processor );
+                if ( maximumLatencyInMilliseconds > 0 )
+                    setupLowLatencyEngine( processor, maximumLatencyInMilliseconds ); // errchk
+                processor.reset();
+                ready_[ preset ].store( true, std::memory_order_release );
+            }
+        },
+        std::move( presetFiles )
+    );
+
+    return true;
+}
+
+
+void PresetBank::clear()
+{
+    if ( loader_.joinable() )
+    {
+        cancelLoading_.store( true, std::memory_order_relaxed );
+        loader_.join();
+    }
+    processors_.clear();
+    ready_     .reset();
+    numberOfPresets_ = 0;
+    active_.store( 0   , std::memory_order_relaxed );
+    state_ .store( Idle, std::memory_order_release );
+}
+
+
+bool PresetBank::ready( std::uint8_t const presetIndex ) const
+{
+    return ( presetIndex < numberOfPresets_ ) && ready_[ presetIndex ].load( std::memory_order_acquire );
+}
+
+
+bool PresetBank::switchInProgress() const { return state_.load( std::memory_order_acquire ) != Idle; }
+
+
+bool PresetBank::select( std::uint8_t const presetIndex )
+{
+    if ( !ready( presetIndex ) || switchInProgress() )
+        return false;
+    auto const active( activePreset() );
+    if ( presetIndex == active )
+        return true;
+
+    // Neither the active nor a switched-from processor: the audio thread does
+    // not touch it so it can be flushed here (and its leftover signal from
+    // the last time it was active is not faded in).
+    processors_[ presetIndex ]->reset();
+
+    // The audio thread outputs silence (and does not touch the processor)
+    // while the active preset is not loaded (e.g. the initial preset is still
+    // loading or failed to load) so there is nothing to crossfade from: switch
+    // immediately.
+    if ( !ready( active ) )
+    {
+        active_.store( presetIndex, std::memory_order_release );
+        return true;
+    }
+
+    target_ = presetIndex;
+    state_.store( Pending, std::memory_order_release );
+    return true;
+}
+
+
+void PresetBank::process( float * pInterleavedInputOutput, std::uint32_t sampleFrames )
+{
+    if ( !numberOfPresets_ )
+        return;
+    auto const numberOfChannels( numberOfChannels_ );
+    while ( sampleFrames )
+    {
+        auto const chunkFrames( static_cast<std::uint16_t>( std::min<std::uint32_t>( sampleFrames, maximumBlockSize_ ) ) );
+        processChunk( pInterleavedInputOutput, chunkFrames );
+        pInterleavedInputOutput += chunkFrames * numberOfChannels;
+        sampleFrames            -= chunkFrames;
+    }
+}
+
+
+void PresetBank::processChunk( float * const pInterleavedInputOutput, std::uint16_t const sampleFrames )
+{
+    auto const activeIndex( active_.load( std::memory_order_acquire ) );
+    auto &     active     ( *processors_[ activeIndex ] );
+    if ( !ready_[ activeIndex ].load( std::memory_order_acquire ) )
+    {
+        std::memset( pInterleavedInputOutput, 0, sampleFrames * numberOfChannels_ * sizeof( float ) );
+        return;
+    }
+
+    if ( state_.load( std::memory_order_acquire ) == Pending )
+    {
+        state_.store( Switching, std::memory_order_relaxed );
+        crossfade_.start( active.latencyInSamples(), processors_[ target_ ]->latencyInSamples() );
+    }
+
+    if ( state_.load( std::memory_order_relaxed ) != Switching )
+    {
+        active.process( pInterleavedInputOutput, sampleFrames );
+        return;
+    }
+
+    if ( crossfade_.process( active, *processors_[ target_ ], pInterleavedInputOutput, sampleFrames ) )
+    {
+        active_.store( target_, std::memory_order_release );
+        state_ .store( Idle   , std::memory_order_release );
+    }
+}
+
+//------------------------------------------------------------------------------
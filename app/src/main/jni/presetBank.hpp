@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// presetBank.hpp
+/// --------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef presetBank_hpp__E7CE52ED_ED50_42F5_9F80_4EA1697BFAC0
+#define presetBank_hpp__E7CE52ED_ED50_42F5_9F80_4EA1697BFAC0
+#pragma once
+//------------------------------------------------------------------------------
+#include "processorSwitching.hpp"
+
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+#include <le/utility/filesystem.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// PresetBank
+// ----------
+//
+// Calling loadPreset() while processing (e.g. to switch between the bundled
+// assets/presets during live input) parses the preset, allocates the new
+// module chain and engine buffers and resets the processor - causing both
+// audio thread stalls and clicks. A preset bank instead loads every preset
+// into its own processor ahead of time, on a background thread, so that
+// switching presets (select()) is merely a change of the active processor
+// index. Like with ReconfigurableProcessor the audio thread first runs the
+// newly selected (reset) processor for its latency and then crossfades to it
+// (see ProcessorCrossfade).
+//
+// Memory use grows with the number of presets (one complete processor each)
+// so this is meant for a handful of presets (e.g. the 16 bundled ones) rather
+// than for whole preset libraries.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class PresetBank
+{
+public:
+    PresetBank();
+    ~PresetBank();
+
+    // Control thread (while not processing): creates a processor for each of
+    // the <presetFiles> and starts loading the presets into them on a
+    // background thread, in the given order. The first preset is initially
+    // active (until it is loaded, or if it fails to load, the output is
+    // silence until another preset is selected). A positive latency
+    // budget passes each processor through setupLowLatencyEngine(). Zero
+    // crossfade frames = switch abruptly (after the warm up).
+    template <LE::Utility::SpecialLocations location>
+    bool prepare
+    (
+        std::vector<std::string> presetFiles,
+        std::uint8_t             numberOfChannels,
+        std::uint32_t            sampleRate,
+        std::uint16_t            maximumBlockSize,
+        std::uint16_t            crossfadeFrames,
+        float                    maximumLatencyInMilliseconds = 0
+    )
+    {
+        return prepare( std::move( presetFiles ), &loadPreset<location>, numberOfChannels, sampleRate, maximumBlockSize, crossfadeFrames, maximumLatencyInMilliseconds );
+    }
+
+    // Control thread: stops the background loading (if still in progress) and
+    // frees all the processors.
+    void clear();
+
+    std::uint8_t numberOfPresets() const { return numberOfPresets_; }
+    // Whether the preset was successfully loaded (a preset that failed to load
+    // is never ready).
+    bool ready( std::uint8_t presetIndex ) const;
+
+    // Control thread: starts the switch to the given (ready) preset. Fails
+    // while a previous switch is still in progress. If the active preset is
+    // not ready (still loading or failed to load) there is nothing to
+    // crossfade from and the switch is immediate.
+    bool select( std::uint8_t presetIndex );
+    bool switchInProgress() const;
+
+    // The last selected preset that the audio thread has completely switched
+    // to.
+    std::uint8_t activePreset() const { return active_.load( std::memory_order_acquire ); }
+
+    // Audio thread (interleaved, in-place).
+    void process( float * pInterleavedInputOutput, std::uint32_t sampleFrames );
+
+private:
+    typedef bool ( * PresetLoader )( LE::SW::Engine::ModuleProcessor &, char const * presetFile );
+
+    template <LE::Utility::SpecialLocations location>
+    static bool loadPreset( LE::SW::Engine::ModuleProcessor & processor, char const * const presetFile ) { return processor.loadPreset<location>( presetFile ); }
+
+    bool prepare( std::vector<std::string> presetFiles, PresetLoader, std::uint8_t numberOfChannels, std::uint32_t sampleRate, std::uint16_t maximumBlockSize, std::uint16_t crossfadeFrames, float maximumLatencyInMilliseconds );
+
+    void processChunk( float * pInterleavedInputOutput, std::uint16_t sampleFrames );
+
+    enum State { Idle, Pending, Switching };
+
+private:
+    // Written by prepare()/clear() only (while not processing).
+    std::vector<LE::SW::Engine::ModuleProcessorPtr> processors_      ;
+    std::unique_ptr<std::atomic<bool>[]>            ready_           ;
+    std::uint8_t                                    numberOfPresets_ ;
+    std::uint8_t                                    numberOfChannels_;
+    std::uint16_t                                   maximumBlockSize_;
+
+    std::thread       loader_       ;
+    std::atomic<bool> cancelLoading_;
+
+    std::atomic<std::uint8_t> active_;
+    std::uint8_t              target_; // published by the release store of state_
+    std::atomic<State>        state_ ;
+
+    ProcessorCrossfade crossfade_;
+}; // class PresetBank
+
+//------------------------------------------------------------------------------
+#endif // presetBank_hpp
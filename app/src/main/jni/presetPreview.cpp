@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// presetPreview.cpp
+/// -----------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "presetPreview.hpp"
+
+#include <le/utility/trace.hpp>
+
+#include <cassert>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+
+
+PresetPreviewRenderer::PresetPreviewRenderer( WorkerPool * const pSharedPool )
+    :
+    pOwnPool_        ( pSharedPool ? nullptr : new WorkerPool ), // errchk
+    pool_            ( pSharedPool ? *pSharedPool : *pOwnPool_ ),
+    numberOfChannels_( 0 ),
+    sampleRate_      ( 0 ),
+    maximumBlockSize_( 0 )
+{}
+
+
+void PresetPreviewRenderer::setup( std::uint8_t const numberOfChannels, std::uint32_t const sampleRate, std::uint32_t const maximumBlockSize )
+{
+    previews_.clear();
+    numberOfChannels_ = numberOfChannels;
+    sampleRate_       = sampleRate      ;
+    maximumBlockSize_ = maximumBlockSize;
+}
+
+
+SW::Engine::ModuleProcessorPtr PresetPreviewRenderer::createProcessor()
+{
+    assert( numberOfChannels_ && "setup() not called" );
+    if ( previews_.size() == WorkerPool::maximumNumberOfTasks )
+    {
+        Utility::Tracer::error( "Too many preview presets (max %u).", WorkerPool::maximumNumberOfTasks );
+        return nullptr;
+    }
+    auto pProcessor( SW::Engine::ModuleProcessor::create() );
+    if ( !pProcessor || !pProcessor->setAudioFormat( numberOfChannels_, sampleRate_ ) )
+        return nullptr;
+    return pProcessor;
+}
+
+
+int PresetPreviewRenderer::addProcessor( SW::Engine::ModuleProcessorPtr pProcessor )
+{
+    Preview preview;
+    preview.pProcessor = std::move( pProcessor );
+    preview.samples .resize( numberOfChannels_ * maximumBlockSize_ ); // errchk
+    preview.channels.resize( numberOfChannels_                     );
+    for ( std::uint8_t channel( 0 ); channel < numberOfChannels_; ++channel )
+        preview.channels[ channel ] = &preview.samples[ channel * maximumBlockSize_ ];
+    previews_.push_back( std::move( preview ) ); // errchk
+    return static_cast<int>( previews_.size() - 1 );
+}
+
+
+void PresetPreviewRenderer::reset()
+{
+    for ( auto & preview : previews_ )
+        preview.pProcessor->reset();
+}
+
+
+bool PresetPreviewRenderer::process( float const * const * const inputs, std::uint32_t const sampleFrames )
+{
+    if ( sampleFrames > maximumBlockSize_ )
+    {
+        Utility::Tracer::error( "Preview block too long (%u frames, max %u).", sampleFrames, maximumBlockSize_ );
+        return false;
+    }
+    auto presetTask
+    (
+        [ = ]( std::uint8_t const preset )
+        {
+            auto & preview( previews_[ preset ] );
+            preview.pProcessor->process( inputs, nullptr, preview.channels.data(), sampleFrames );
+        }
+    );
+    pool_.run( numberOfPresets(), presetTask );
+    return true;
+}
+
+//------------------------------------------------------------------------------
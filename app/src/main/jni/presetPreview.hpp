@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// presetPreview.hpp
+/// -----------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef presetPreview_hpp__99846579_8469_4E99_8EA6_963449312024
+#define presetPreview_hpp__99846579_8469_4E99_8EA6_963449312024
+#pragma once
+//------------------------------------------------------------------------------
+#include "parallelProcessing.hpp"
+
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+#include <le/utility/filesystem.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// PresetPreviewRenderer
+// ---------------------
+//
+// Renders one input signal through many presets at once (e.g. for preset
+// preview thumbnails). The input is read only and shared by all the presets,
+// each preset has its own ModuleProcessor and output buffers and the presets
+// are processed concurrently on a WorkerPool.
+//
+// The analysis (windowing + FFT) of the input is performed inside each
+// ModuleProcessor and the engine does not expose its spectrum so it cannot be
+// shared between the chains: the cost of adding a preset is therefore one
+// full ModuleProcessor, spread over the available cores. For best throughput
+// keep the WOLA parameters of all the presets identical (so that all the
+// processors have the same step size and workload per block).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class PresetPreviewRenderer
+{
+public:
+    explicit PresetPreviewRenderer( WorkerPool * pSharedPool = nullptr );
+
+    // Must be called before adding presets (clears previously added ones).
+    void setup( std::uint8_t numberOfChannels, std::uint32_t sampleRate, std::uint32_t maximumBlockSize );
+
+    // Returns the index of the added preset or -1 on failure.
+    template <LE::Utility::SpecialLocations rootLocation>
+    int addPreset( char const * const presetFile )
+    {
+        auto pProcessor( createProcessor() );
+        if ( !pProcessor || !pProcessor->loadPreset<rootLocation>( presetFile ) )
+            return -1;
+        return addProcessor( std::move( pProcessor ) );
+    }
+
+    std::uint8_t numberOfPresets() const { return static_cast<std::uint8_t>( previews_.size() ); }
+
+    LE::SW::Engine::ModuleProcessor & processor( std::uint8_t const preset ) { return *previews_[ preset ].pProcessor; }
+
+    void reset();
+
+    // Processes <sampleFrames> frames of separated input channels through all
+    // the presets. The results are available through output() until the next
+    // call to process(). Blocks longer than the maximumBlockSize passed to
+    // setup() do not fit the output buffers: they are rejected (false is
+    // returned and the outputs are left as they were).
+    bool process( float const * const * inputs, std::uint32_t sampleFrames );
+
+    float const * const * output( std::uint8_t const preset ) const { return previews_[ preset ].channels.data(); }
+
+private:
+    struct Preview
+    {
+        LE::SW::Engine::ModuleProcessorPtr pProcessor;
+        std::vector<float  >               samples   ;
+        std::vector<float *>               channels  ;
+    }; // struct Preview
+
+    LE::SW::Engine::ModuleProcessorPtr createProcessor();
+    int                                addProcessor   ( LE::SW::Engine::ModuleProcessorPtr );
+
+private:
+    std::unique_ptr<WorkerPool> pOwnPool_;
+    WorkerPool                & pool_    ;
+
+    std::vector<Preview> previews_;
+
+    std::uint8_t  numberOfChannels_;
+    std::uint32_t sampleRate_      ;
+    std::uint32_t maximumBlockSize_;
+}; // class PresetPreviewRenderer
+
+//------------------------------------------------------------------------------
+#endif // presetPreview_hpp
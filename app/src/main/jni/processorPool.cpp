@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// processorPool.cpp
+/// -----------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "processorPool.hpp"
+
+#include <le/spectrumworx/engine/moduleChain.hpp>
+
+#include <algorithm>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+
+
+EngineSetup currentEngineSetup( SW::Engine::ModuleProcessor const & processor )
+{
+    EngineSetup const setup =
+    {
+        processor.numberOfChannels(),
+        processor.sampleRate      (),
+        currentWOLAParameters( processor )
+    };
+    return setup;
+}
+
+
+ProcessorPool::ProcessorPtr ProcessorPool::create( EngineSetup const & setup )
+{
+    auto pProcessor( SW::Engine::ModuleProcessor::create() ); // errchk
+    if
+    (
+        !pProcessor ||
+        !pProcessor->setEngineParameters
+        (
+            setup.numberOfChannels,
+            setup.sampleRate,
+            setup.wola.fftSize,
+            setup.wola.overlapFactor,
+            setup.wola.window
+        )
+    )
+        return ProcessorPtr();
+    return pProcessor;
+}
+
+
+bool ProcessorPool::prewarm( EngineSetup const & setup, std::uint16_t const numberOfProcessors )
+{
+    // The (slow) setup is done outside the lock.
+    for ( auto idle( idleProcessors( setup ) ); idle < numberOfProcessors; ++idle )
+    {
+        auto pProcessor( create( setup ) );
+        if ( !pProcessor )
+            return false;
+        std::lock_guard<std::mutex> const lock( mutex_ );
+        processors_.emplace_back( setup, std::move( pProcessor ) ); // errchk
+    }
+    return true;
+}
+
+
+ProcessorPool::ProcessorPtr ProcessorPool::acquire( EngineSetup const & setup )
+{
+    {
+        std::lock_guard<std::mutex> const lock( mutex_ );
+        auto const pEntry
+        (
+            std::find_if
+            (
+                processors_.begin(), processors_.end(),
+                [ & ]( Entry const & entry ) { return entry.first == setup; }
+            )
+        );
+        if ( pEntry != processors_.end() )
+        {
+            auto result( std::move( pEntry->second ) );
+            processors_.erase( pEntry );
+            return result;
+        }
+    }
+    return create( setup );
+}
+
+
+void ProcessorPool::recycle( ProcessorPtr pProcessor )
+{
+    // (e.g. the result of a failed acquire())
+    if ( !pProcessor )
+        return;
+
+    pProcessor->moduleChain().clear();
+    pProcessor->setGain   ( 1 );
+    pProcessor->setWetness( 1 );
+    pProcessor->reset();
+
+    auto const setup( currentEngineSetup( *pProcessor ) );
+    std::lock_guard<std::mutex> const lock( mutex_ );
+    processors_.emplace_back( setup, std::move( pProcessor ) ); // errchk
+}
+
+
+std::uint16_t ProcessorPool::idleProcessors( EngineSetup const & setup ) const
+{
+    std::lock_guard<std::mutex> const lock( mutex_ );
+    return static_cast<std::uint16_t>
+    (
+        std::count_if
+        (
+            processors_.begin(), processors_.end(),
+            [ & ]( Entry const & entry ) { return entry.first == setup; }
+        )
+    );
+}
+
+
+void ProcessorPool::clear()
+{
+    std::vector<Entry> processors;
+    {
+        std::lock_guard<std::mutex> const lock( mutex_ );
+        processors.swap( processors_ );
+    }
+    // (the processors are destroyed outside the lock)
+}
+
+//------------------------------------------------------------------------------
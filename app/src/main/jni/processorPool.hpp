@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// processorPool.hpp
+/// -----------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef processorPool_hpp__A265583D_1EB2_4B57_B793_D99E120C8A88
+#define processorPool_hpp__A265583D_1EB2_4B57_B793_D99E120C8A88
+#pragma once
+//------------------------------------------------------------------------------
+#include "engineSetup.hpp"
+
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// EngineSetup
+// -----------
+//
+// The complete set of engine parameters that determine the (size of the)
+// internal buffers and tables of a ModuleProcessor.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+struct EngineSetup
+{
+    std::uint8_t   numberOfChannels;
+    std::uint32_t  sampleRate      ;
+    WOLAParameters wola            ;
+
+    bool operator==( EngineSetup const & other ) const
+    {
+        return
+            ( numberOfChannels   == other.numberOfChannels   ) &&
+            ( sampleRate         == other.sampleRate         ) &&
+            ( wola.fftSize       == other.wola.fftSize       ) &&
+            ( wola.overlapFactor == other.wola.overlapFactor ) &&
+            ( wola.window        == other.wola.window        );
+    }
+}; // struct EngineSetup
+
+EngineSetup currentEngineSetup( LE::SW::Engine::ModuleProcessor const & );
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// ProcessorPool
+// -------------
+//
+// Every ModuleProcessor allocates and computes its own window and FFT tables
+// (and frame buffers) when its engine parameters are set, so with many streams
+// starting at the same time setEngineParameters() dominates the startup
+// time. The pool keeps processors that are already set up, keyed by their
+// EngineSetup: prewarm() creates them ahead of time (e.g. at application
+// startup, before the first stream arrives), acquire() hands out a ready
+// processor (or creates one if none is available) and recycle() takes it back
+// for reuse by the next stream with the same setup. Thread safe.
+//
+// Recycled processors are handed out with an empty module chain, a reset
+// signal state and unity gain and wetness. Note that loadPreset() also loads
+// the preset's engine parameters: the pool only saves work for processors
+// whose chain is built in code or whose presets use the same engine setup.
+// It is meant for hosts that run many concurrent streams: the example app
+// itself runs a single stream (and its multi-processor helpers, like
+// PresetBank and PresetPreviewRenderer, load presets) so it does not use it.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class ProcessorPool
+{
+public:
+    typedef LE::SW::Engine::ModuleProcessorPtr ProcessorPtr;
+
+    // Makes sure at least <numberOfProcessors> idle processors with the given
+    // setup are available.
+    bool prewarm( EngineSetup const &, std::uint16_t numberOfProcessors );
+
+    // Returns null on allocation failure.
+    ProcessorPtr acquire( EngineSetup const & );
+    // Null pointers are ignored.
+    void         recycle( ProcessorPtr );
+
+    std::uint16_t idleProcessors( EngineSetup const & ) const;
+
+    // Frees all idle processors.
+    void clear();
+
+private:
+    static ProcessorPtr create( EngineSetup const & );
+
+    typedef std::pair<EngineSetup, ProcessorPtr> Entry;
+
+private:
+    mutable std::mutex mutex_     ;
+    std::vector<Entry> processors_;
+}; // class ProcessorPool
+
+//------------------------------------------------------------------------------
+#endif // processorPool_hpp
@@ -0,0 +1,309 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// processorSwitching.cpp
+/// ----------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "processorSwitching.hpp"
+
+#include "moduleChainUtilities.hpp"
+
+#include <le/utility/trace.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ProcessorCrossfade
+////////////////////////////////////////////////////////////////////////////////
+
+ProcessorCrossfade::ProcessorCrossfade()
+    :
+    delay_        ( 0     ),
+    delayPosition_( 0     ),
+    delayFrom_    ( false ),
+    fadeStart_    ( 0     ),
+    elapsed_      ( 0     )
+{}
+
+
+void ProcessorCrossfade::setup( std::uint8_t const numberOfChannels, std::uint16_t const maximumBlockSize, std::uint16_t const crossfadeFrames )
+{
+    assert( maximumBlockSize );
+
+    toBuffer_ .resize( maximumBlockSize                      * numberOfChannels ); // errchk
+    gains_    .resize( crossfadeFrames                                          ); // errchk
+    delayLine_.resize( SW::Engine::Constants::maximumFFTSize * numberOfChannels ); // errchk
+    delayed_  .resize(                                         numberOfChannels ); // errchk
+    float const pi( 3.14159265358979f );
+    for ( std::uint16_t frame( 0 ); frame < crossfadeFrames; ++frame )
+        gains_[ frame ] = std::sin( ( frame + 0.5f ) / crossfadeFrames * pi / 2 );
+}
+
+
+void ProcessorCrossfade::start( std::uint32_t const fromLatency, std::uint32_t const toLatency )
+{
+    delayFrom_     = toLatency > fromLatency;
+    delay_         = delayFrom_ ? toLatency - fromLatency : fromLatency - toLatency;
+    delayPosition_ = 0;
+    fadeStart_     = std::max( fromLatency, toLatency );
+    elapsed_       = 0;
+    assert( delay_ * delayed_.size() <= delayLine_.size() );
+    std::fill( delayLine_.begin(), delayLine_.begin() + delay_ * delayed_.size(), 0.0f );
+}
+
+
+namespace
+{
+    // Length of the fades that smooth over the time jump of a latency change
+    // (short enough not to be heard as a comb filter).
+    std::uint32_t const declickFrames = 64;
+
+    float declickGain( std::uint32_t const position ) { return ( position + 0.5f ) / declickFrames; }
+} // anonymous namespace
+
+
+bool ProcessorCrossfade::process( SW::Engine::ModuleProcessor & from, SW::Engine::ModuleProcessor & to, float * const pInterleavedInputOutput, std::uint16_t const sampleFrames )
+{
+    auto const numberOfChannels( from.numberOfChannels() );
+    auto const numberOfSamples ( sampleFrames * numberOfChannels );
+    auto const pToData         ( &toBuffer_[ 0 ] );
+    assert( numberOfSamples <= static_cast<int>( toBuffer_.size() ) );
+    std::memcpy( pToData, pInterleavedInputOutput, numberOfSamples * sizeof( float ) );
+    from.process( pInterleavedInputOutput, sampleFrames );
+    to  .process( pToData                , sampleFrames );
+
+    // Timeline (in frames since start()):
+    // - [ 0, fadeStart ): the <from> output (when it is to be delayed: first
+    //   undelayed, then declicked into the delayed one once the delay line
+    //   has filled up)
+    // - [ fadeStart, fadeEnd ): the (latency aligned) crossfade
+    // - [ fadeEnd, end ): when the <to> output was delayed, declicked into
+    //   the undelayed one.
+    auto const crossfadeFrames( static_cast<std::uint32_t>( gains_.size() ) );
+    auto const fadeEnd        ( fadeStart_ + crossfadeFrames );
+    auto const end            ( fadeEnd + ( ( delay_ && !delayFrom_ ) ? declickFrames : 0 ) );
+    auto const pDelayed       ( &delayed_[ 0 ] );
+    for ( std::uint16_t frame( 0 ); frame < sampleFrames; ++frame, ++elapsed_ )
+    {
+        auto const pFromFrame( &pInterleavedInputOutput[ frame * numberOfChannels ] );
+        auto const pToFrame  ( &pToData                [ frame * numberOfChannels ] );
+        if ( elapsed_ >= end )
+        {
+            std::copy( pToFrame, pToFrame + numberOfChannels, pFromFrame );
+            continue;
+        }
+
+        if ( delay_ )
+        {
+            auto const pDelayLine( &delayLine_[ delayPosition_ * numberOfChannels ] );
+            auto const pInput    ( delayFrom_ ? pFromFrame : pToFrame );
+            for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+            {
+                pDelayed  [ channel ] = pDelayLine[ channel ];
+                pDelayLine[ channel ] = pInput    [ channel ];
+            }
+            if ( ++delayPosition_ == delay_ )
+                delayPosition_ = 0;
+        }
+        bool  const  fromDelayed( delay_ &&  delayFrom_ && ( elapsed_ >= delay_ ) );
+        bool  const  toDelayed  ( delay_ && !delayFrom_                           );
+        float const * pFromPath ( fromDelayed ? pDelayed : pFromFrame );
+        float const * pToPath   ( toDelayed   ? pDelayed : pToFrame   );
+
+        if ( elapsed_ < fadeStart_ )
+        {
+            if ( fromDelayed && ( elapsed_ < delay_ + declickFrames ) )
+            {
+                float const gain( declickGain( elapsed_ - delay_ ) );
+                for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+                    pFromFrame[ channel ] += ( pDelayed[ channel ] - pFromFrame[ channel ] ) * gain;
+            }
+            else
+            {
+                std::copy( pFromPath, pFromPath + numberOfChannels, pFromFrame );
+            }
+        }
+        else
+        if ( elapsed_ < fadeEnd )
+        {
+            // Equal-power: the fade out gain is the time-reversed fade in gain
+            // (sin/cos).
+            auto  const position( elapsed_ - fadeStart_ );
+            float const fadeIn ( gains_[                       position ] );
+            float const fadeOut( gains_[ crossfadeFrames - 1 - position ] );
+            for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+                pFromFrame[ channel ] = pFromPath[ channel ] * fadeOut + pToPath[ channel ] * fadeIn;
+        }
+        else
+        {
+            float const gain( declickGain( elapsed_ - fadeEnd ) );
+            for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+                pFromFrame[ channel ] = pDelayed[ channel ] + ( pToFrame[ channel ] - pDelayed[ channel ] ) * gain;
+        }
+    }
+
+    return elapsed_ >= end;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ReconfigurableProcessor
+////////////////////////////////////////////////////////////////////////////////
+
+ReconfigurableProcessor::ReconfigurableProcessor()
+    :
+    active_          ( 0    ),
+    state_           ( Idle ),
+    epoch_           ( 0    ),
+    reclaimedEpoch_  ( 0    ),
+    maximumBlockSize_( 0    )
+{}
+
+
+bool ReconfigurableProcessor::setup( SW::Engine::ModuleProcessor const & source, std::uint16_t const maximumBlockSize, std::uint16_t const crossfadeFrames )
+{
+    assert( !switchInProgress() );
+    assert( maximumBlockSize && crossfadeFrames );
+
+    for ( auto & pProcessor : processors_ )
+    {
+        pProcessor = SW::Engine::ModuleProcessor::create();
+        if ( !pProcessor || !copyProcessorSetup( source, *pProcessor ) )
+            return false;
+    }
+    active_.store( 0, std::memory_order_release );
+    reclaimedEpoch_ = epoch();
+
+    maximumBlockSize_ = maximumBlockSize;
+    crossfade_.setup( source.numberOfChannels(), maximumBlockSize, crossfadeFrames );
+
+    return true;
+}
+
+
+SW::Engine::ModuleProcessor * ReconfigurableProcessor::prepareStandby()
+{
+    // The clone has to include the queued in-place parameter changes.
+    if ( switchInProgress() || !parameterChanges_.empty() )
+        return nullptr;
+    reclaim();
+
+    auto const & active ( processor       () );
+    auto       & standby( standbyProcessor() );
+    if ( !copyProcessorSetup( active, standby ) )
+    {
+        Utility::Tracer::error( "Failed to prepare the standby processor." );
+        return nullptr;
+    }
+    return &standby;
+}
+
+
+void ReconfigurableProcessor::publish()
+{
+    standbyProcessor().reset();
+    state_.store( Pending, std::memory_order_release );
+}
+
+
+bool ReconfigurableProcessor::reconfigure( WOLAParameters const & parameters )
+{
+    auto const pStandby( prepareStandby() );
+    if ( !pStandby )
+        return false;
+    if ( !pStandby->setWOLAParameters( parameters.fftSize, parameters.overlapFactor, parameters.window ) )
+    {
+        Utility::Tracer::error( "Failed to prepare the engine reconfiguration." );
+        return false;
+    }
+    publish();
+    return true;
+}
+
+
+bool ReconfigurableProcessor::setParameter( std::uint8_t const moduleIndex, std::uint8_t const parameterIndex, float const value )
+{
+    if ( switchInProgress() )
+        return false;
+    auto const & chain( processor().moduleChain() );
+    if ( moduleIndex >= chain.size() || parameterIndex >= chain[ moduleIndex ].numberOfParameters() )
+        return false;
+    ParameterChange const change = { value, moduleIndex, parameterIndex };
+    return parameterChanges_.push( change );
+}
+
+
+void ReconfigurableProcessor::reclaim()
+{
+    if ( switchInProgress() )
+        return;
+    auto const currentEpoch( epoch() );
+    if ( currentEpoch == reclaimedEpoch_ )
+        return;
+    // The audio thread no longer touches the standby (retired) processor.
+    auto & retired( standbyProcessor() );
+    retired.moduleChain().clear();
+    retired.reset();
+    reclaimedEpoch_ = currentEpoch;
+}
+
+
+void ReconfigurableProcessor::process( float * pInterleavedInputOutput, std::uint32_t sampleFrames )
+{
+    auto const numberOfChannels( processor().numberOfChannels() );
+    while ( sampleFrames )
+    {
+        auto const chunkFrames( static_cast<std::uint16_t>( std::min<std::uint32_t>( sampleFrames, maximumBlockSize_ ) ) );
+        processChunk( pInterleavedInputOutput, chunkFrames );
+        pInterleavedInputOutput += chunkFrames * numberOfChannels;
+        sampleFrames            -= chunkFrames;
+    }
+}
+
+
+void ReconfigurableProcessor::processChunk( float * const pInterleavedInputOutput, std::uint16_t const sampleFrames )
+{
+    auto & active( processor() );
+
+    // Popped only once applied: prepareStandby() waits for an empty queue.
+    while ( auto const pChange = parameterChanges_.front() )
+    {
+        active.moduleChain()[ pChange->moduleIndex ].setParameter( pChange->parameterIndex, pChange->value );
+        parameterChanges_.popFront();
+    }
+
+    if ( state_.load( std::memory_order_acquire ) == Pending )
+    {
+        state_.store( Switching, std::memory_order_relaxed );
+        crossfade_.start( active.latencyInSamples(), standbyProcessor().latencyInSamples() );
+    }
+
+    if ( state_.load( std::memory_order_relaxed ) != Switching )
+    {
+        active.process( pInterleavedInputOutput, sampleFrames );
+        return;
+    }
+
+    if ( crossfade_.process( active, standbyProcessor(), pInterleavedInputOutput, sampleFrames ) )
+    {
+        // The old processor is left as is: it is cleaned up by the control
+        // thread (see reclaim()).
+        active_.store( active_.load( std::memory_order_relaxed ) ^ 1, std::memory_order_release );
+        epoch_ .fetch_add( 1, std::memory_order_release );
+        state_ .store( Idle, std::memory_order_release );
+    }
+}
+
+//------------------------------------------------------------------------------
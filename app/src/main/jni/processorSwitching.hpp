@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// processorSwitching.hpp
+/// ----------------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef processorSwitching_hpp__C1E62076_5BFD_4DA1_A902_4D95397368AE
+#define processorSwitching_hpp__C1E62076_5BFD_4DA1_A902_4D95397368AE
+#pragma once
+//------------------------------------------------------------------------------
+#include "engineSetup.hpp"
+#include "lockFreeQueue.hpp"
+
+#include <le/spectrumworx/engine/moduleChain.hpp>
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// ProcessorCrossfade
+// ------------------
+//
+// Audio thread part of a glitch-free transition from one running processor to
+// another (one that was reset or has not been processing the stream): the
+// new processor is first run, in parallel with the old one, until its output
+// is valid and then the outputs are crossfaded (equal-power). All the buffers
+// are allocated up front by setup().
+//
+// Processors with different latencies (FFT sizes) output the same signal at
+// different times so mixing them directly comb-filters. The lower latency
+// output is therefore delayed by the latency difference for the crossfade.
+// The time jump that any latency change implies (the output repeats or skips
+// the difference) cannot be avoided but it is moved outside of the crossfade
+// and smoothed with a short declicking fade: when the latency grows the old
+// output is delayed (during the warm up) and when it shrinks the new output
+// drops its delay (after the crossfade).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class ProcessorCrossfade
+{
+public:
+    ProcessorCrossfade();
+
+    // Control thread (while not processing). Zero crossfade frames = switch
+    // abruptly (after the warm up).
+    void setup( std::uint8_t numberOfChannels, std::uint16_t maximumBlockSize, std::uint16_t crossfadeFrames );
+
+    // Audio thread: starts a transition between processors with the given
+    // latencies (which may differ by less than the maximum FFT size).
+    void start( std::uint32_t fromLatency, std::uint32_t toLatency );
+
+    // Audio thread: processes (in-place, interleaved) at most
+    // maximumBlockSize frames with both processors and outputs the mix.
+    // Returns true once the transition is complete (i.e. once only <to>
+    // needs to be processed).
+    bool process( LE::SW::Engine::ModuleProcessor & from, LE::SW::Engine::ModuleProcessor & to, float * interleavedInputOutput, std::uint16_t sampleFrames );
+
+private:
+    std::vector<float> toBuffer_ ;
+    std::vector<float> gains_    ; // sin( x * pi/2 ), x in (0, 1)
+    std::vector<float> delayLine_; // interleaved ring of delay_ frames
+    std::vector<float> delayed_  ; // one frame, read from the delay line
+
+    std::uint32_t delay_        ; // latency difference
+    std::uint32_t delayPosition_;
+    bool          delayFrom_    ; // otherwise the <to> output is delayed
+    std::uint32_t fadeStart_    ; // the higher latency
+    std::uint32_t elapsed_      ; // frames since start()
+}; // class ProcessorCrossfade
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// ReconfigurableProcessor
+// -----------------------
+//
+// Allows changing the WOLA parameters of a running stream without stopping
+// the audio device and without allocating or blocking on the audio thread.
+//
+// Two ModuleProcessors are held: the active one and a standby one. A
+// reconfiguration is prepared entirely on the control thread, on the standby
+// processor (setWOLAParameters() and the module chain cloning, i.e. all the
+// allocation, happens there), and is then published with a single atomic
+// store. At the start of the next process() call (a frame boundary) the audio
+// thread starts feeding both processors: the new one first runs for its
+// latency (so that its output is valid) and then the outputs are crossfaded
+// (equal-power) after which the new processor becomes the active one. All the
+// buffers used for this are allocated up front by setup().
+//
+// Structural module chain edits are handled the same way (read-copy-update):
+// edit() applies the edit to a fresh clone of the active setup in the standby
+// processor and publishes it as a whole, so the audio thread never sees a
+// chain being modified. As the clone starts from a clean signal state (e.g.
+// reverb tails restart) and both processors run during the crossfade this is
+// meant for adding/removing/reordering modules. Plain parameter changes
+// (setParameter()) are instead queued and applied in place, in between
+// chunks, by the audio thread. The retired processor, with its modules, is
+// cleaned up on the control thread (reclaim()) once the audio thread has
+// moved on, as signalled by the switch epoch: module references obtained from
+// processor() (e.g. pointers handed to the UI) are only valid until then and
+// have to be refetched whenever epoch() changes.
+//
+// The number of channels and the sample rate define the audio stream itself
+// (the device has to be restarted to change them) so they are fixed by
+// setup().
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class ReconfigurableProcessor
+{
+public:
+    ReconfigurableProcessor();
+
+    // Control thread (while not processing): clones <source>'s complete setup
+    // into both internal processors.
+    bool setup( LE::SW::Engine::ModuleProcessor const & source, std::uint16_t maximumBlockSize, std::uint16_t crossfadeFrames = 1024 );
+
+    // Control thread: prepares the standby processor with the current module
+    // setup and the new WOLA parameters and queues the switch. Fails if a
+    // previous switch is still in progress.
+    bool reconfigure( WOLAParameters const & );
+
+    // Control thread: <edit> (callable as bool( ModuleChain & )) is applied to
+    // a copy of the active chain which is then switched to. Fails if a
+    // previous switch or parameter change is still in progress or if <edit>
+    // returns false. Module references obtained from the old chain refer to
+    // the retired processor after the switch (and dangle after reclaim()).
+    template <typename ChainEdit>
+    bool edit( ChainEdit && edit )
+    {
+        auto const pStandby( prepareStandby() );
+        if ( !pStandby || !edit( pStandby->moduleChain() ) )
+            return false;
+        publish();
+        return true;
+    }
+
+    // Control thread: queues an in-place change of a parameter of the
+    // <moduleIndex>-th module of the active chain (no clone, no crossfade).
+    // Fails while a switch is in progress (the chains may then differ) or if
+    // the queue is full.
+    bool setParameter( std::uint8_t moduleIndex, std::uint8_t parameterIndex, float value );
+
+    // Control thread: releases the modules and signal state of the processor
+    // retired by the last completed switch (done automatically before the
+    // next switch is prepared).
+    void reclaim();
+
+    // Number of completed switches (incremented by the audio thread).
+    std::uint32_t epoch() const { return epoch_.load( std::memory_order_acquire ); }
+
+    bool switchInProgress() const { return state_.load( std::memory_order_acquire ) != Idle; }
+
+    // Audio thread: in-place, interleaved processing, any number of frames.
+    void process( float * interleavedInputOutput, std::uint32_t sampleFrames );
+
+    // The currently active processor: safe to access from the control thread
+    // only while !switchInProgress() (with the usual caveats for modifying
+    // module parameters while processing).
+    LE::SW::Engine::ModuleProcessor       & processor()       { return *processors_[ active_.load( std::memory_order_acquire ) ]; }
+    LE::SW::Engine::ModuleProcessor const & processor() const { return *processors_[ active_.load( std::memory_order_acquire ) ]; }
+
+private:
+    enum State : std::uint8_t
+    {
+        Idle     , // only the active processor is running
+        Pending  , // the standby processor is ready (set by the control thread)
+        Switching  // warming up/crossfading (set by the audio thread)
+    }; // enum State
+
+    struct ParameterChange
+    {
+        float        value         ;
+        std::uint8_t moduleIndex   ;
+        std::uint8_t parameterIndex;
+    }; // struct ParameterChange
+
+    void processChunk( float * interleavedInputOutput, std::uint16_t sampleFrames );
+
+    LE::SW::Engine::ModuleProcessor * prepareStandby();
+    void                              publish       ();
+
+    LE::SW::Engine::ModuleProcessor & standbyProcessor() { return *processors_[ active_.load( std::memory_order_relaxed ) ^ 1 ]; }
+
+private:
+    LE::SW::Engine::ModuleProcessorPtr processors_[ 2 ];
+    std::atomic<std::uint8_t>          active_;
+    std::atomic<State       >          state_ ;
+    std::atomic<std::uint32_t>         epoch_ ;
+    std::uint32_t                      reclaimedEpoch_; // control thread
+
+    SPSCQueue<ParameterChange, 256> parameterChanges_;
+
+    ProcessorCrossfade crossfade_       ;
+    std::uint16_t      maximumBlockSize_;
+}; // class ReconfigurableProcessor
+
+//------------------------------------------------------------------------------
+#endif // processorSwitching_hpp
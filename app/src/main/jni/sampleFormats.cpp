@@ -0,0 +1,540 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// sampleFormats.cpp
+/// -----------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "sampleFormats.hpp"
+
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+#include <le/utility/trace.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+#if defined( __ARM_NEON__ ) || defined( __ARM_NEON )
+    #include <arm_neon.h>
+    #define LE_EXAMPLE_NEON 1
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+    #include <emmintrin.h>
+    #define LE_EXAMPLE_SSE2 1
+    // A single x86 build carries AVX2 versions of the kernels as well and
+    // selects them at load time if the CPU (and OS) supports AVX2.
+    #if defined( __GNUC__ ) && !defined( __AVX2__ )
+        #include <cpuid.h>
+        #include <immintrin.h>
+        #define LE_EXAMPLE_AVX2_DISPATCH 1
+    #endif
+#endif
+#if defined( LE_EXAMPLE_NEON ) || defined( LE_EXAMPLE_SSE2 )
+    #define LE_EXAMPLE_SIMD 1
+#endif
+//------------------------------------------------------------------------------
+
+using namespace LE;
+
+
+namespace
+{
+    float const int16Scale = 32768.0f;
+    float const int24Scale = 8388608.0f;
+
+    // Saturation is done in the float domain (so that all code paths round
+    // and clip identically).
+    float clamp( float const value, float const scale ) { return std::max( -scale, std::min( value * scale, scale - 1 ) ); }
+
+    // Keep the stack footprint of the processing functions reasonable.
+    std::uint16_t const scratchSize = 2048;
+
+    // The scratch buffer split into per channel chunks (for the separated
+    // channels process() overload). Chunks are kept at least 64 frames long
+    // which limits the number of channels.
+    struct ChannelScratch
+    {
+        static std::uint8_t const maximumNumberOfChannels = scratchSize / 64;
+
+        // Fails (with a trace) for more channels than can be served.
+        bool setup( std::uint8_t const numberOfChannels )
+        {
+            if ( numberOfChannels > maximumNumberOfChannels )
+            {
+                LE::Utility::Tracer::error( "Too many channels (%u) for separated processing (at most %u).", numberOfChannels, maximumNumberOfChannels );
+                return false;
+            }
+            chunkFrames = static_cast<std::uint16_t>( scratchSize / numberOfChannels );
+            for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+                channels[ channel ] = &data[ channel * chunkFrames ];
+            return true;
+        }
+
+        float         data    [ scratchSize             ];
+        float       * channels[ maximumNumberOfChannels ];
+        std::uint16_t chunkFrames;
+    }; // struct ChannelScratch
+} // anonymous namespace
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Conversion kernels
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    void int16ToFloat( std::int16_t const * pInput, float * pOutput, std::uint32_t numberOfSamples )
+    {
+        float const scale( 1 / int16Scale );
+#if defined( LE_EXAMPLE_NEON )
+        float32x4_t const vScale( vdupq_n_f32( scale ) );
+        for ( ; numberOfSamples >= 8; numberOfSamples -= 8, pInput += 8, pOutput += 8 )
+        {
+            int16x8_t const samples( vld1q_s16( pInput ) );
+            vst1q_f32( pOutput + 0, vmulq_f32( vcvtq_f32_s32( vmovl_s16( vget_low_s16 ( samples ) ) ), vScale ) );
+            vst1q_f32( pOutput + 4, vmulq_f32( vcvtq_f32_s32( vmovl_s16( vget_high_s16( samples ) ) ), vScale ) );
+        }
+#elif defined( LE_EXAMPLE_SSE2 )
+        __m128 const vScale( _mm_set1_ps( scale ) );
+        for ( ; numberOfSamples >= 8; numberOfSamples -= 8, pInput += 8, pOutput += 8 )
+        {
+            __m128i const samples( _mm_loadu_si128( reinterpret_cast<__m128i const *>( pInput ) ) );
+            // Sign extend by unpacking into the upper halves and shifting back.
+            __m128i const low ( _mm_srai_epi32( _mm_unpacklo_epi16( samples, samples ), 16 ) );
+            __m128i const high( _mm_srai_epi32( _mm_unpackhi_epi16( samples, samples ), 16 ) );
+            _mm_storeu_ps( pOutput + 0, _mm_mul_ps( _mm_cvtepi32_ps( low  ), vScale ) );
+            _mm_storeu_ps( pOutput + 4, _mm_mul_ps( _mm_cvtepi32_ps( high ), vScale ) );
+        }
+#endif
+        while ( numberOfSamples-- )
+            *pOutput++ = *pInput++ * scale;
+    }
+
+
+    void floatToInt16( float const * pInput, std::int16_t * pOutput, std::uint32_t numberOfSamples )
+    {
+#if defined( LE_EXAMPLE_NEON )
+        float32x4_t const vScale( vdupq_n_f32( int16Scale ) );
+        float32x4_t const vMin  ( vdupq_n_f32( -int16Scale     ) );
+        float32x4_t const vMax  ( vdupq_n_f32(  int16Scale - 1 ) );
+        for ( ; numberOfSamples >= 8; numberOfSamples -= 8, pInput += 8, pOutput += 8 )
+        {
+            float32x4_t const low ( vmaxq_f32( vMin, vminq_f32( vmulq_f32( vld1q_f32( pInput + 0 ), vScale ), vMax ) ) );
+            float32x4_t const high( vmaxq_f32( vMin, vminq_f32( vmulq_f32( vld1q_f32( pInput + 4 ), vScale ), vMax ) ) );
+            vst1q_s16( pOutput, vcombine_s16( vmovn_s32( vcvtq_s32_f32( low ) ), vmovn_s32( vcvtq_s32_f32( high ) ) ) );
+        }
+#elif defined( LE_EXAMPLE_SSE2 )
+        __m128 const vScale( _mm_set1_ps( int16Scale ) );
+        __m128 const vMin  ( _mm_set1_ps( -int16Scale     ) );
+        __m128 const vMax  ( _mm_set1_ps(  int16Scale - 1 ) );
+        for ( ; numberOfSamples >= 8; numberOfSamples -= 8, pInput += 8, pOutput += 8 )
+        {
+            __m128 const low ( _mm_max_ps( vMin, _mm_min_ps( _mm_mul_ps( _mm_loadu_ps( pInput + 0 ), vScale ), vMax ) ) );
+            __m128 const high( _mm_max_ps( vMin, _mm_min_ps( _mm_mul_ps( _mm_loadu_ps( pInput + 4 ), vScale ), vMax ) ) );
+            _mm_storeu_si128( reinterpret_cast<__m128i *>( pOutput ), _mm_packs_epi32( _mm_cvttps_epi32( low ), _mm_cvttps_epi32( high ) ) );
+        }
+#endif
+        while ( numberOfSamples-- )
+            *pOutput++ = static_cast<std::int16_t>( clamp( *pInput++, int16Scale ) );
+    }
+
+#if defined( LE_EXAMPLE_AVX2_DISPATCH )
+    __attribute__(( target( "avx2" ) ))
+    void int16ToFloatAVX2( std::int16_t const * pInput, float * pOutput, std::uint32_t numberOfSamples )
+    {
+        __m256 const vScale( _mm256_set1_ps( 1 / int16Scale ) );
+        for ( ; numberOfSamples >= 16; numberOfSamples -= 16, pInput += 16, pOutput += 16 )
+        {
+            __m256i const low ( _mm256_cvtepi16_epi32( _mm_loadu_si128( reinterpret_cast<__m128i const *>( pInput + 0 ) ) ) );
+            __m256i const high( _mm256_cvtepi16_epi32( _mm_loadu_si128( reinterpret_cast<__m128i const *>( pInput + 8 ) ) ) );
+            _mm256_storeu_ps( pOutput + 0, _mm256_mul_ps( _mm256_cvtepi32_ps( low  ), vScale ) );
+            _mm256_storeu_ps( pOutput + 8, _mm256_mul_ps( _mm256_cvtepi32_ps( high ), vScale ) );
+        }
+        int16ToFloat( pInput, pOutput, numberOfSamples );
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    void floatToInt16AVX2( float const * pInput, std::int16_t * pOutput, std::uint32_t numberOfSamples )
+    {
+        __m256 const vScale( _mm256_set1_ps( int16Scale ) );
+        __m256 const vMin  ( _mm256_set1_ps( -int16Scale     ) );
+        __m256 const vMax  ( _mm256_set1_ps(  int16Scale - 1 ) );
+        for ( ; numberOfSamples >= 16; numberOfSamples -= 16, pInput += 16, pOutput += 16 )
+        {
+            __m256 const low ( _mm256_max_ps( vMin, _mm256_min_ps( _mm256_mul_ps( _mm256_loadu_ps( pInput + 0 ), vScale ), vMax ) ) );
+            __m256 const high( _mm256_max_ps( vMin, _mm256_min_ps( _mm256_mul_ps( _mm256_loadu_ps( pInput + 8 ), vScale ), vMax ) ) );
+            // packs works within 128 bit lanes: restore the sample order.
+            __m256i const packed( _mm256_packs_epi32( _mm256_cvttps_epi32( low ), _mm256_cvttps_epi32( high ) ) );
+            _mm256_storeu_si256( reinterpret_cast<__m256i *>( pOutput ), _mm256_permute4x64_epi64( packed, 0xD8 ) );
+        }
+        floatToInt16( pInput, pOutput, numberOfSamples );
+    }
+
+    bool cpuSupportsAVX2()
+    {
+        unsigned int eax, ebx, ecx, edx;
+        if ( !__get_cpuid( 1, &eax, &ebx, &ecx, &edx ) )
+            return false;
+        // The OS has to save the YMM registers on context switches (OSXSAVE +
+        // XCR0 SSE and AVX state bits).
+        if ( !( ecx & bit_OSXSAVE ) || !( ecx & bit_AVX ) )
+            return false;
+        unsigned int xcr0Low, xcr0High;
+        __asm__( "xgetbv" : "=a"( xcr0Low ), "=d"( xcr0High ) : "c"( 0 ) );
+        if ( ( xcr0Low & 0x6 ) != 0x6 )
+            return false;
+        if ( __get_cpuid_max( 0, nullptr ) < 7 )
+            return false;
+        __cpuid_count( 7, 0, eax, ebx, ecx, edx );
+        return ( ebx & bit_AVX2 ) != 0;
+    }
+
+    bool const haveAVX2( cpuSupportsAVX2() );
+#endif // LE_EXAMPLE_AVX2_DISPATCH
+} // anonymous namespace
+
+
+void convertInt16ToFloat( std::int16_t const * const pInput, float * const pOutput, std::uint32_t const numberOfSamples )
+{
+#if defined( LE_EXAMPLE_AVX2_DISPATCH )
+    if ( haveAVX2 )
+        return int16ToFloatAVX2( pInput, pOutput, numberOfSamples );
+#endif
+    int16ToFloat( pInput, pOutput, numberOfSamples );
+}
+
+
+void convertFloatToInt16( float const * const pInput, std::int16_t * const pOutput, std::uint32_t const numberOfSamples )
+{
+#if defined( LE_EXAMPLE_AVX2_DISPATCH )
+    if ( haveAVX2 )
+        return floatToInt16AVX2( pInput, pOutput, numberOfSamples );
+#endif
+    floatToInt16( pInput, pOutput, numberOfSamples );
+}
+
+
+char const * conversionKernelsInstructionSet()
+{
+#if defined( LE_EXAMPLE_NEON )
+    return "NEON";
+#elif defined( LE_EXAMPLE_AVX2_DISPATCH )
+    return haveAVX2 ? "AVX2" : "SSE2";
+#elif defined( LE_EXAMPLE_SSE2 )
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+
+// Packed 24 bit samples do not map onto SIMD lanes without (per ISA)
+// shuffles so these are left to the compiler's auto-vectoriser.
+
+void convertInt24ToFloat( std::uint8_t const * pInput, float * pOutput, std::uint32_t numberOfSamples )
+{
+    float const scale( 1 / int24Scale );
+    for ( ; numberOfSamples; --numberOfSamples, pInput += 3 )
+    {
+        // Assemble in the upper 24 bits and shift back down to sign extend.
+        auto const sample( static_cast<std::int32_t>( ( std::uint32_t( pInput[ 0 ] ) << 8 ) | ( std::uint32_t( pInput[ 1 ] ) << 16 ) | ( std::uint32_t( pInput[ 2 ] ) << 24 ) ) >> 8 );
+        *pOutput++ = sample * scale;
+    }
+}
+
+
+void convertFloatToInt24( float const * pInput, std::uint8_t * pOutput, std::uint32_t numberOfSamples )
+{
+    for ( ; numberOfSamples; --numberOfSamples, pOutput += 3 )
+    {
+        auto const sample( static_cast<std::int32_t>( clamp( *pInput++, int24Scale ) ) );
+        pOutput[ 0 ] = static_cast<std::uint8_t>( sample       );
+        pOutput[ 1 ] = static_cast<std::uint8_t>( sample >>  8 );
+        pOutput[ 2 ] = static_cast<std::uint8_t>( sample >> 16 );
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Channel layout kernels
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+#if defined( LE_EXAMPLE_SIMD )
+#if defined( LE_EXAMPLE_NEON )
+    typedef float32x4_t Vector;
+
+    Vector load ( float const * const pInput            ) { return vld1q_f32( pInput ); }
+    void   store( float       * const pOutput, Vector v ) { vst1q_f32( pOutput, v );    }
+
+    void unzip( Vector const a, Vector const b, Vector & even, Vector & odd )
+    {
+        auto const result( vuzpq_f32( a, b ) );
+        even = result.val[ 0 ];
+        odd  = result.val[ 1 ];
+    }
+
+    void zip( Vector const even, Vector const odd, Vector & a, Vector & b )
+    {
+        auto const result( vzipq_f32( even, odd ) );
+        a = result.val[ 0 ];
+        b = result.val[ 1 ];
+    }
+
+    void transpose( Vector & a, Vector & b, Vector & c, Vector & d )
+    {
+        auto const ab( vtrnq_f32( a, b ) );
+        auto const cd( vtrnq_f32( c, d ) );
+        a = vcombine_f32( vget_low_f32 ( ab.val[ 0 ] ), vget_low_f32 ( cd.val[ 0 ] ) );
+        b = vcombine_f32( vget_low_f32 ( ab.val[ 1 ] ), vget_low_f32 ( cd.val[ 1 ] ) );
+        c = vcombine_f32( vget_high_f32( ab.val[ 0 ] ), vget_high_f32( cd.val[ 0 ] ) );
+        d = vcombine_f32( vget_high_f32( ab.val[ 1 ] ), vget_high_f32( cd.val[ 1 ] ) );
+    }
+#else // SSE2
+    typedef __m128 Vector;
+
+    Vector load ( float const * const pInput            ) { return _mm_loadu_ps( pInput ); }
+    void   store( float       * const pOutput, Vector v ) { _mm_storeu_ps( pOutput, v );   }
+
+    void unzip( Vector const a, Vector const b, Vector & even, Vector & odd )
+    {
+        even = _mm_shuffle_ps( a, b, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+        odd  = _mm_shuffle_ps( a, b, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+    }
+
+    void zip( Vector const even, Vector const odd, Vector & a, Vector & b )
+    {
+        a = _mm_unpacklo_ps( even, odd );
+        b = _mm_unpackhi_ps( even, odd );
+    }
+
+    void transpose( Vector & a, Vector & b, Vector & c, Vector & d ) { _MM_TRANSPOSE4_PS( a, b, c, d ); }
+#endif // ISA
+
+    // Dense (frameStride == numberOfChannels) 2, 4 and 8 channel layouts, four
+    // frames at a time: 2 channels are split into even and odd lanes while
+    // 4 and 8 channels are transposed in 4x4 blocks. Return the number of
+    // frames done (the caller handles the remainder and other layouts).
+
+    std::uint32_t deinterleaveDense( float const * pInput, float * const * const pChannels, std::uint8_t const numberOfChannels, std::uint32_t const sampleFrames )
+    {
+        std::uint32_t frame( 0 );
+        switch ( numberOfChannels )
+        {
+            case 2:
+                for ( ; frame + 4 <= sampleFrames; frame += 4, pInput += 4 * 2 )
+                {
+                    Vector left, right;
+                    unzip( load( pInput ), load( pInput + 4 ), left, right );
+                    store( pChannels[ 0 ] + frame, left  );
+                    store( pChannels[ 1 ] + frame, right );
+                }
+                break;
+
+            case 4:
+            case 8:
+                for ( ; frame + 4 <= sampleFrames; frame += 4, pInput += 4 * numberOfChannels )
+                {
+                    for ( std::uint8_t channel( 0 ); channel < numberOfChannels; channel += 4 )
+                    {
+                        Vector a( load( pInput + channel + 0 * numberOfChannels ) );
+                        Vector b( load( pInput + channel + 1 * numberOfChannels ) );
+                        Vector c( load( pInput + channel + 2 * numberOfChannels ) );
+                        Vector d( load( pInput + channel + 3 * numberOfChannels ) );
+                        transpose( a, b, c, d );
+                        store( pChannels[ channel + 0 ] + frame, a );
+                        store( pChannels[ channel + 1 ] + frame, b );
+                        store( pChannels[ channel + 2 ] + frame, c );
+                        store( pChannels[ channel + 3 ] + frame, d );
+                    }
+                }
+                break;
+        }
+        return frame;
+    }
+
+    std::uint32_t interleaveDense( float const * const * const pChannels, float * pOutput, std::uint8_t const numberOfChannels, std::uint32_t const sampleFrames )
+    {
+        std::uint32_t frame( 0 );
+        switch ( numberOfChannels )
+        {
+            case 2:
+                for ( ; frame + 4 <= sampleFrames; frame += 4, pOutput += 4 * 2 )
+                {
+                    Vector a, b;
+                    zip( load( pChannels[ 0 ] + frame ), load( pChannels[ 1 ] + frame ), a, b );
+                    store( pOutput + 0, a );
+                    store( pOutput + 4, b );
+                }
+                break;
+
+            case 4:
+            case 8:
+                for ( ; frame + 4 <= sampleFrames; frame += 4, pOutput += 4 * numberOfChannels )
+                {
+                    for ( std::uint8_t channel( 0 ); channel < numberOfChannels; channel += 4 )
+                    {
+                        Vector a( load( pChannels[ channel + 0 ] + frame ) );
+                        Vector b( load( pChannels[ channel + 1 ] + frame ) );
+                        Vector c( load( pChannels[ channel + 2 ] + frame ) );
+                        Vector d( load( pChannels[ channel + 3 ] + frame ) );
+                        transpose( a, b, c, d );
+                        store( pOutput + channel + 0 * numberOfChannels, a );
+                        store( pOutput + channel + 1 * numberOfChannels, b );
+                        store( pOutput + channel + 2 * numberOfChannels, c );
+                        store( pOutput + channel + 3 * numberOfChannels, d );
+                    }
+                }
+                break;
+        }
+        return frame;
+    }
+#endif // LE_EXAMPLE_SIMD
+} // anonymous namespace
+
+
+void deinterleave( StridedChannels const & source, float * const * const pChannels, std::uint32_t const sampleFrames )
+{
+    auto const numberOfChannels( source.numberOfChannels );
+    auto const stride          ( source.frameStride      );
+    std::uint32_t firstFrame( 0 );
+    if ( stride == numberOfChannels )
+    {
+        if ( numberOfChannels == 1 )
+        {
+            std::copy( source.pFirstSample, source.pFirstSample + sampleFrames, pChannels[ 0 ] );
+            return;
+        }
+    #if defined( LE_EXAMPLE_SIMD )
+        firstFrame = deinterleaveDense( source.pFirstSample, pChannels, numberOfChannels, sampleFrames );
+    #endif
+    }
+    for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+    {
+        float const * pInput( source.pFirstSample + firstFrame * stride + channel );
+        for ( auto frame( firstFrame ); frame < sampleFrames; ++frame, pInput += stride )
+            pChannels[ channel ][ frame ] = *pInput;
+    }
+}
+
+
+void interleave( float const * const * const pChannels, StridedChannels const & target, std::uint32_t const sampleFrames )
+{
+    auto const numberOfChannels( target.numberOfChannels );
+    auto const stride          ( target.frameStride      );
+    std::uint32_t firstFrame( 0 );
+    if ( stride == numberOfChannels )
+    {
+        if ( numberOfChannels == 1 )
+        {
+            std::copy( pChannels[ 0 ], pChannels[ 0 ] + sampleFrames, target.pFirstSample );
+            return;
+        }
+    #if defined( LE_EXAMPLE_SIMD )
+        firstFrame = interleaveDense( pChannels, target.pFirstSample, numberOfChannels, sampleFrames );
+    #endif
+    }
+    for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+    {
+        float * pOutput( target.pFirstSample + firstFrame * stride + channel );
+        for ( auto frame( firstFrame ); frame < sampleFrames; ++frame, pOutput += stride )
+            *pOutput = pChannels[ channel ][ frame ];
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Processing
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    template <typename Sample, std::uint8_t bytesPerSample, typename ToFloat, typename FromFloat>
+    void processInterleaved( SW::Engine::ModuleProcessor & processor, Sample * pInputOutput, std::uint32_t sampleFrames, ToFloat const toFloat, FromFloat const fromFloat )
+    {
+        auto const numberOfChannels( processor.numberOfChannels() );
+        auto const chunkFrames     ( static_cast<std::uint16_t>( scratchSize / numberOfChannels ) );
+        float scratch[ scratchSize ];
+        while ( sampleFrames )
+        {
+            auto const frames ( std::min<std::uint32_t>( sampleFrames, chunkFrames ) );
+            auto const samples( frames * numberOfChannels );
+            toFloat          ( pInputOutput, scratch, samples );
+            processor.process( scratch, frames );
+            fromFloat        ( scratch, pInputOutput, samples );
+            pInputOutput += samples * bytesPerSample / sizeof( Sample );
+            sampleFrames -= frames;
+        }
+    }
+
+    template <typename Sample, std::uint8_t bytesPerSample, typename ToFloat, typename FromFloat>
+    void processSeparated( SW::Engine::ModuleProcessor & processor, Sample * const * const pInputsOutputs, std::uint32_t const sampleFrames, ToFloat const toFloat, FromFloat const fromFloat )
+    {
+        auto const numberOfChannels( processor.numberOfChannels() );
+        ChannelScratch scratch;
+        if ( !scratch.setup( numberOfChannels ) )
+            return;
+        auto const chunkFrames( scratch.chunkFrames );
+        auto const channels   ( scratch.channels    );
+
+        for ( std::uint32_t frame( 0 ); frame < sampleFrames; )
+        {
+            auto const frames( std::min<std::uint32_t>( sampleFrames - frame, chunkFrames ) );
+            auto const offset( frame * bytesPerSample / sizeof( Sample ) );
+            for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+                toFloat( pInputsOutputs[ channel ] + offset, channels[ channel ], frames );
+            processor.process( channels, frames );
+            for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+                fromFloat( channels[ channel ], pInputsOutputs[ channel ] + offset, frames );
+            frame += frames;
+        }
+    }
+} // anonymous namespace
+
+
+void processStrided( SW::Engine::ModuleProcessor & processor, StridedChannels const & inputOutput, std::uint32_t sampleFrames )
+{
+    assert( inputOutput.numberOfChannels == processor.numberOfChannels() );
+    ChannelScratch scratch;
+    if ( !scratch.setup( inputOutput.numberOfChannels ) )
+        return;
+    auto const chunkFrames( scratch.chunkFrames );
+    auto const channels   ( scratch.channels    );
+
+    StridedChannels chunk( inputOutput );
+    while ( sampleFrames )
+    {
+        auto const frames( std::min<std::uint32_t>( sampleFrames, chunkFrames ) );
+        deinterleave     ( chunk, channels, frames );
+        processor.process( channels, frames );
+        interleave       ( channels, chunk, frames );
+        chunk.pFirstSample += frames * chunk.frameStride;
+        sampleFrames       -= frames;
+    }
+}
+
+
+void processInt16( SW::Engine::ModuleProcessor & processor, std::int16_t * const pInputOutput, std::uint32_t const sampleFrames )
+{
+    processInterleaved<std::int16_t, 2>( processor, pInputOutput, sampleFrames, &convertInt16ToFloat, &convertFloatToInt16 );
+}
+
+void processInt16( SW::Engine::ModuleProcessor & processor, std::int16_t * const * const pInputsOutputs, std::uint32_t const sampleFrames )
+{
+    processSeparated<std::int16_t, 2>( processor, pInputsOutputs, sampleFrames, &convertInt16ToFloat, &convertFloatToInt16 );
+}
+
+void processInt24( SW::Engine::ModuleProcessor & processor, std::uint8_t * const pInputOutput, std::uint32_t const sampleFrames )
+{
+    processInterleaved<std::uint8_t, 3>( processor, pInputOutput, sampleFrames, &convertInt24ToFloat, &convertFloatToInt24 );
+}
+
+void processInt24( SW::Engine::ModuleProcessor & processor, std::uint8_t * const * const pInputsOutputs, std::uint32_t const sampleFrames )
+{
+    processSeparated<std::uint8_t, 3>( processor, pInputsOutputs, sampleFrames, &convertInt24ToFloat, &convertFloatToInt24 );
+}
+
+//------------------------------------------------------------------------------
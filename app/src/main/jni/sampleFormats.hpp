@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// sampleFormats.hpp
+/// -----------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef sampleFormats_hpp__C8CAFBA0_B5D7_4533_BE3B_7FC6E0BB30EB
+#define sampleFormats_hpp__C8CAFBA0_B5D7_4533_BE3B_7FC6E0BB30EB
+#pragma once
+//------------------------------------------------------------------------------
+#include <cstdint>
+//------------------------------------------------------------------------------
+namespace LE { namespace SW { namespace Engine { class ModuleProcessor; } } }
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Integer sample format support
+// -----------------------------
+//
+// ModuleProcessor::process() works with floats while device and codec paths
+// often deliver 16 bit or packed 24 bit (little endian, 3 bytes per sample)
+// integer PCM. Instead of converting whole buffers to float and back (two
+// extra passes over memory plus full size scratch buffers) the process*()
+// functions below work in small chunks: each chunk is converted into a small
+// stack buffer, processed and converted back while still in the L1 cache.
+//
+// Float <-> integer conversion uses the [-1, 1) <-> [INT_MIN, INT_MAX] mapping
+// with saturation and truncation (towards zero).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/// \name Conversion kernels (vectorised for NEON and SSE2 where available).
+/// x86 builds also contain AVX2 versions of the 16 bit kernels which are
+/// selected at load time on CPUs that support them.
+/// @{
+void convertInt16ToFloat( std::int16_t const * input, float        * output, std::uint32_t numberOfSamples );
+void convertFloatToInt16( float        const * input, std::int16_t * output, std::uint32_t numberOfSamples );
+void convertInt24ToFloat( std::uint8_t const * input, float        * output, std::uint32_t numberOfSamples );
+void convertFloatToInt24( float        const * input, std::uint8_t * output, std::uint32_t numberOfSamples );
+
+// "NEON", "AVX2", "SSE2" or "scalar" (for logging).
+char const * conversionKernelsInstructionSet();
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Channel layouts
+// ---------------
+//
+// ModuleProcessor's interleaved process() overloads have additional overhead
+// compared to the separated channels versions (the engine deinterleaves the
+// data internally). StridedChannels describes channels stored with a
+// constant distance between consecutive frames: a device's interleaved
+// buffer or a subset of the channels of a wider one (e.g. the first two
+// channels of a four channel buffer: frameStride = 4, numberOfChannels = 2).
+// processStrided() feeds such data to the separated channels process()
+// through small (L1 resident) stack chunks, using vectorised shuffle kernels
+// for the dense (frameStride == numberOfChannels) 1, 2, 4 and 8 channel
+// cases.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+struct StridedChannels
+{
+    float        * pFirstSample    ; // (of the first channel)
+    std::uint16_t  frameStride     ; // in samples (>= numberOfChannels)
+    std::uint8_t   numberOfChannels;
+}; // struct StridedChannels
+
+/// \name (De)interleaving kernels.
+/// @{
+void deinterleave( StridedChannels const & source  , float       * const * channels, std::uint32_t sampleFrames );
+void interleave  ( float const * const *   channels, StridedChannels const & target , std::uint32_t sampleFrames );
+/// @}
+
+// In-place, through the separated channels process() (the processor must
+// have <inputOutput.numberOfChannels> channels, at most 32: the data is left
+// unprocessed otherwise).
+void processStrided( LE::SW::Engine::ModuleProcessor &, StridedChannels const & inputOutput, std::uint32_t sampleFrames );
+
+/// \name In-place processing of integer samples.
+/// The separated channels overloads support at most 32 channels (the data is
+/// left unprocessed otherwise).
+/// @{
+void processInt16( LE::SW::Engine::ModuleProcessor &, std::int16_t *         interleavedInputOutput, std::uint32_t sampleFrames );
+void processInt16( LE::SW::Engine::ModuleProcessor &, std::int16_t * const * inputsAndOutputs      , std::uint32_t sampleFrames );
+void processInt24( LE::SW::Engine::ModuleProcessor &, std::uint8_t *         interleavedInputOutput, std::uint32_t sampleFrames );
+void processInt24( LE::SW::Engine::ModuleProcessor &, std::uint8_t * const * inputsAndOutputs      , std::uint32_t sampleFrames );
+/// @}
+
+//------------------------------------------------------------------------------
+#endif // sampleFormats_hpp
@@ -0,0 +1,309 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// silenceGate.cpp
+/// ---------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include "silenceGate.hpp"
+
+#include <le/parameters/lfo.hpp>
+#include <le/parameters/runtimeInformation.hpp>
+#include <le/spectrumworx/engine/moduleChain.hpp>
+#include <le/spectrumworx/engine/moduleFactory.hpp>
+
+#include <le/spectrumworx/effects/exImploder.hpp>
+#include <le/spectrumworx/effects/frecho.hpp>
+#include <le/spectrumworx/effects/freqverb.hpp>
+#include <le/spectrumworx/effects/reverser.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+//------------------------------------------------------------------------------
+
+using namespace LE;
+using namespace LE::SW;
+using Engine::ModuleBase;
+using Engine::Module;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Effect tails
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    float const speedOfSound = 343; // m/s
+
+    // ModuleBase::effectName() returns the effect's type name (the same one
+    // ModuleBase::create() accepts).
+    bool is( ModuleBase const & module, char const * const effectName ) { return std::strcmp( module.effectName(), effectName ) == 0; }
+
+    // The extreme values a parameter can take while processing.
+    template <class Effect, class Parameter>
+    float upperBound( ModuleBase const & module )
+    {
+        auto const index( Module<Effect>::template parameterIndex<Parameter>() );
+        return module.lfo( index ).enabled() ? module.parameterInfo( index ).maximum : module.getParameter( index );
+    }
+
+    template <class Effect, class Parameter>
+    float lowerBound( ModuleBase const & module )
+    {
+        auto const index( Module<Effect>::template parameterIndex<Parameter>() );
+        return module.lfo( index ).enabled() ? module.parameterInfo( index ).minimum : module.getParameter( index );
+    }
+
+    // Effects that compute each output frame from the current input frame(s)
+    // alone. Any history they keep (phase or pitch tracking, adaptive gains)
+    // only shapes signal that is present at the input so they go silent
+    // together with it. Effects that are not listed here are assumed to be
+    // able to sustain their output indefinitely (e.g. SlewLimiter, Smoother,
+    // Freqnamics, Convolver, Exploder, Freeze).
+    char const * const memorylessEffects[] =
+    {
+        "AhAh"             ,
+        "Armonizer"        ,
+        "Bandpass"         ,
+        "Bandstop"         ,
+        "Blender"          ,
+        "CentroidExtractor",
+        "Denoiser"         ,
+        "Ethereal"         ,
+        "Exaggerator"      ,
+        "Gain"             ,
+        "Inserter"         ,
+        "Merger"           ,
+        "Octaver"          ,
+        "Phasevolution"    ,
+        "Phlip"            ,
+        "PitchShifter"     ,
+        "PitchSpring"      ,
+        "Quantizer"        ,
+        "Robotizer"        ,
+        "Shapeless"        ,
+        "Sharper"          ,
+        "Shifter"          ,
+        "Swappah"          ,
+        "TalkingWind"      ,
+        "Tonal"            ,
+        "Whisperer"        ,
+        "Wobbler"          ,
+    };
+
+    bool isMemoryless( ModuleBase const & module )
+    {
+        return std::any_of
+        (
+            std::begin( memorylessEffects ), std::end( memorylessEffects ),
+            [ &module ]( char const * const effectName ) { return is( module, effectName ); }
+        );
+    }
+
+    // Negative = infinite.
+    template <class Effect>
+    float echoTailInSeconds( ModuleBase const & module, float const decayInDB )
+    {
+        // Each echo travels to the reflecting surface and back, losing
+        // Absorption dB on the way.
+        auto const absorption( lowerBound<Effect, typename Effect::Absorption>( module ) );
+        if ( absorption <= 0 )
+            return -1;
+        auto const distance      ( upperBound<Effect, typename Effect::Distance>( module ) );
+        auto const numberOfEchoes( std::ceil( decayInDB / absorption ) );
+        return numberOfEchoes * 2 * distance / speedOfSound;
+    }
+
+    float tailInSeconds( ModuleBase const & module, float const decayInDB )
+    {
+        using namespace Effects;
+
+        if ( is( module, "Freqverb" ) )
+            return upperBound<Freqverb, Freqverb::Time60dB>( module ) * decayInDB / 60;
+        if ( is( module, "Frecho" ) )
+            return echoTailInSeconds<Frecho >( module, decayInDB );
+        if ( is( module, "Frevcho" ) )
+            return echoTailInSeconds<Frevcho>( module, decayInDB );
+        if ( is( module, "Reverser" ) )
+            // A complete chunk is buffered before it is played back reversed.
+            return 2 * upperBound<Reverser, Reverser::Length>( module ) / 1000;
+        if ( is( module, "Imploder" ) || is( module, "PVImploder" ) )
+            // Held magnitudes fall by 120 dB over Decay seconds.
+            return upperBound<PVImploder, PVImploder::Decay>( module ) * decayInDB / 120;
+        if ( isMemoryless( module ) )
+            return 0;
+        return -1;
+    }
+} // anonymous namespace
+
+
+std::uint32_t effectTailInSamples( ModuleBase const & module, std::uint32_t const sampleRate, float const silenceThresholdInDB )
+{
+    auto const seconds( tailInSeconds( module, -silenceThresholdInDB ) );
+    if ( seconds < 0 )
+        return tailIsInfinite;
+    return static_cast<std::uint32_t>( std::min<float>( std::ceil( seconds * sampleRate ), tailIsInfinite - 1 ) );
+}
+
+
+std::uint32_t processorTailInSamples( Engine::ModuleProcessor const & processor, float const silenceThresholdInDB )
+{
+    // The last non-silent input sample reaches the output after the engine
+    // latency but it also contributes to (overlapping) frames that extend up
+    // to one frame beyond it.
+    std::uint64_t tail( processor.latencyInSamples() + processor.fftSize() );
+
+    auto const & chain( processor.moduleChain() );
+    for ( std::uint8_t index( 0 ); index < chain.size(); ++index )
+    {
+        auto const moduleTail( effectTailInSamples( chain[ index ], processor.sampleRate(), silenceThresholdInDB ) );
+        if ( moduleTail == tailIsInfinite )
+            return tailIsInfinite;
+        tail += moduleTail;
+    }
+    return static_cast<std::uint32_t>( std::min<std::uint64_t>( tail, tailIsInfinite ) );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SilenceGate
+////////////////////////////////////////////////////////////////////////////////
+
+SilenceGate::SilenceGate()
+    :
+    pProcessor_   ( nullptr                     ),
+    thresholdInDB_( defaultSilenceThresholdInDB ),
+    threshold_    ( 0                           ),
+    tail_         ( tailIsInfinite              ),
+    skippedFrames_( 0                           ),
+    silentFrames_ ( 0                           ),
+    sleeping_     ( false                       )
+{}
+
+
+void SilenceGate::attach( Engine::ModuleProcessor & processor, float const silenceThresholdInDB )
+{
+    pProcessor_    = &processor;
+    thresholdInDB_ = silenceThresholdInDB;
+    threshold_     = std::pow( 10.0f, silenceThresholdInDB / 20 );
+    silentFrames_  = 0;
+    sleeping_      = false;
+    skippedFrames_.store( 0, std::memory_order_relaxed );
+    update();
+}
+
+
+void SilenceGate::update()
+{
+    tail_.store( processorTailInSamples( *pProcessor_, thresholdInDB_ ), std::memory_order_relaxed );
+}
+
+
+namespace
+{
+    std::uint32_t trailingSilence( float const * const pSamples, std::uint32_t const sampleFrames, std::uint8_t const stride, float const threshold )
+    {
+        for ( std::uint32_t frame( sampleFrames ); frame--; )
+        {
+            if ( std::abs( pSamples[ frame * stride ] ) > threshold )
+                return sampleFrames - 1 - frame;
+        }
+        return sampleFrames;
+    }
+} // anonymous namespace
+
+
+std::uint32_t SilenceGate::trailingSilence( float const * const pInterleaved, std::uint32_t const sampleFrames ) const
+{
+    auto const numberOfChannels( pProcessor_->numberOfChannels() );
+    auto       silence         ( sampleFrames );
+    for ( std::uint8_t channel( 0 ); channel < numberOfChannels; ++channel )
+        silence = std::min( silence, ::trailingSilence( pInterleaved + channel, sampleFrames, numberOfChannels, threshold_ ) );
+    return silence;
+}
+
+
+std::uint32_t SilenceGate::trailingSilence( Engine::ModuleProcessor::InputData const channels, std::uint32_t const sampleFrames ) const
+{
+    auto silence( sampleFrames );
+    for ( std::uint8_t channel( 0 ); channel < pProcessor_->numberOfChannels(); ++channel )
+        silence = std::min( silence, ::trailingSilence( channels[ channel ], sampleFrames, 1, threshold_ ) );
+    return silence;
+}
+
+
+bool SilenceGate::wake( std::uint32_t const silence, std::uint32_t const sampleFrames )
+{
+    if ( !sleeping_ )
+        return true;
+    if ( silence == sampleFrames )
+    {
+        skippedFrames_.store( skippedFrames() + sampleFrames, std::memory_order_relaxed );
+        return false;
+    }
+    // Whatever is left in the processor is below the threshold.
+    pProcessor_->reset();
+    sleeping_     = false;
+    silentFrames_ = 0;
+    return true;
+}
+
+
+void SilenceGate::advance( std::uint32_t const silence, std::uint32_t const sampleFrames )
+{
+    silentFrames_ = ( silence == sampleFrames ) ? silentFrames_ + sampleFrames : silence;
+    auto const tail( tailInSamples() );
+    if ( tail != tailIsInfinite && silentFrames_ >= tail )
+        sleeping_ = true;
+}
+
+
+void SilenceGate::process( float * const pMainInOut, float const * const pSideChannel, std::uint32_t const sampleFrames )
+{
+    auto silence( trailingSilence( pMainInOut, sampleFrames ) );
+    if ( pSideChannel )
+        silence = std::min( silence, trailingSilence( pSideChannel, sampleFrames ) );
+
+    if ( !wake( silence, sampleFrames ) )
+    {
+        std::fill_n( pMainInOut, sampleFrames * pProcessor_->numberOfChannels(), 0.0f );
+        return;
+    }
+
+    if ( pSideChannel )
+        pProcessor_->process( pMainInOut, pSideChannel, pMainInOut, sampleFrames );
+    else
+        pProcessor_->process( pMainInOut, sampleFrames );
+
+    advance( silence, sampleFrames );
+}
+
+
+void SilenceGate::process( Engine::ModuleProcessor::OutputData const mainInOut, Engine::ModuleProcessor::InputData const sideChannels, std::uint32_t const sampleFrames )
+{
+    auto silence( trailingSilence( mainInOut, sampleFrames ) );
+    if ( sideChannels )
+        silence = std::min( silence, trailingSilence( sideChannels, sampleFrames ) );
+
+    if ( !wake( silence, sampleFrames ) )
+    {
+        for ( std::uint8_t channel( 0 ); channel < pProcessor_->numberOfChannels(); ++channel )
+            std::fill_n( mainInOut[ channel ], sampleFrames, 0.0f );
+        return;
+    }
+
+    if ( sideChannels )
+        pProcessor_->process( mainInOut, sideChannels, mainInOut, sampleFrames );
+    else
+        pProcessor_->process( mainInOut, sampleFrames );
+
+    advance( silence, sampleFrames );
+}
+
+//------------------------------------------------------------------------------
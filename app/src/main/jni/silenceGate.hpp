@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// silenceGate.hpp
+/// ---------------
+///
+/// LE example app contents (not to be confused with the official SDK API).
+///
+/// Copyright (c) 2011 - 2016. Little Endian Ltd. All rights reserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#ifndef silenceGate_hpp__E58C46B9_8CE0_432E_825D_21A0C52FFC37
+#define silenceGate_hpp__E58C46B9_8CE0_432E_825D_21A0C52FFC37
+#pragma once
+//------------------------------------------------------------------------------
+#include <le/spectrumworx/engine/moduleBase.hpp>
+#include <le/spectrumworx/engine/moduleProcessor.hpp>
+
+#include <atomic>
+#include <cstdint>
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Effect tails
+// ------------
+//
+// The number of sample frames for which <module> can keep producing output
+// after its input has gone silent, i.e. until its output decays below
+// <silenceThresholdInDB> (relative to full scale). Effects that work on the
+// current frame alone report no tail and effects with a bounded memory report
+// it from their parameters (Freqverb: Time60dB, Frecho/Frevcho: Distance and
+// Absorption, Reverser: Length, Imploder: Decay). All the other effects
+// (Freeze, SlewLimiter, Smoother, Freqnamics, Convolver, lossless echoes...)
+// as well as unknown ones report tailIsInfinite. Parameters driven by an
+// enabled LFO are assumed to be at their maximum.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+std::uint32_t const tailIsInfinite = 0xFFFFFFFF;
+
+// Roughly the noise floor of a phone microphone in a quiet room: lower
+// thresholds keep a gate on live input awake forever, offline/synthetic
+// sources can pass a lower one to attach().
+float const defaultSilenceThresholdInDB = -60;
+
+std::uint32_t effectTailInSamples  ( LE::SW::Engine::ModuleBase      const & module   , std::uint32_t sampleRate, float silenceThresholdInDB );
+// Engine latency and analysis window plus the tails of all the modules in the
+// chain (which, being in series, add up).
+std::uint32_t processorTailInSamples( LE::SW::Engine::ModuleProcessor const & processor, float silenceThresholdInDB );
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// SilenceGate
+// -----------
+//
+// Wraps a ModuleProcessor and stops calling its process() member function
+// (outputting zeros instead) once the input has been silent for longer than
+// the processor's tail, i.e. once nothing but silence can come out of it.
+// Processing resumes with the first block that contains a non-silent sample,
+// after a reset() of the processor (its internal state has decayed at that
+// point anyway, so this only flushes the residual, below threshold, signal).
+// For mostly silent streams (e.g. voice chat) this skips the complete
+// FFT -> module chain -> IFFT pipeline for the majority of the time.
+//
+// The tail depends on the module chain and its parameters so update() has to
+// be called (from the control thread) after those change. The gated input is
+// the main input plus, if given, the side chain input (an effect can produce
+// output from a side chain signal alone).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+class SilenceGate
+{
+public:
+    SilenceGate();
+
+    void attach( LE::SW::Engine::ModuleProcessor &, float silenceThresholdInDB = defaultSilenceThresholdInDB );
+    void update();
+
+    // Audio thread: in-place, interleaved or separated channels.
+    void process( float * pMainInOut, float const * pSideChannel, std::uint32_t sampleFrames );
+    void process( float * pMainInOut,                             std::uint32_t sampleFrames ) { process( pMainInOut, nullptr, sampleFrames ); }
+
+    void process( LE::SW::Engine::ModuleProcessor::OutputData mainInOut, LE::SW::Engine::ModuleProcessor::InputData sideChannels, std::uint32_t sampleFrames );
+    void process( LE::SW::Engine::ModuleProcessor::OutputData mainInOut,                                                         std::uint32_t sampleFrames ) { process( mainInOut, nullptr, sampleFrames ); }
+
+    bool          sleeping       () const { return sleeping_; }
+    std::uint32_t tailInSamples  () const { return tail_         .load( std::memory_order_relaxed ); }
+    // Number of sample frames for which processing was skipped.
+    std::uint64_t skippedFrames  () const { return skippedFrames_.load( std::memory_order_relaxed ); }
+
+private:
+    SilenceGate( SilenceGate const & ) = delete;
+    void operator=( SilenceGate const & ) = delete;
+
+    // Number of trailing silent sample frames in the given block (or
+    // sampleFrames if the whole block is silent).
+    std::uint32_t trailingSilence( float const *                              pInterleaved, std::uint32_t sampleFrames ) const;
+    std::uint32_t trailingSilence( LE::SW::Engine::ModuleProcessor::InputData channels, std::uint32_t sampleFrames ) const;
+
+    // Returns false if the block is to be skipped (and zeros output instead).
+    bool wake   ( std::uint32_t trailingSilence, std::uint32_t sampleFrames );
+    void advance( std::uint32_t trailingSilence, std::uint32_t sampleFrames );
+
+private:
+    LE::SW::Engine::ModuleProcessor * pProcessor_   ;
+    float                             thresholdInDB_;
+    float                             threshold_    ;
+
+    std::atomic<std::uint32_t> tail_         ;
+    std::atomic<std::uint64_t> skippedFrames_;
+
+    // Audio thread state
+    std::uint32_t silentFrames_;
+    bool          sleeping_    ;
+}; // class SilenceGate
+
+//------------------------------------------------------------------------------
+#endif // silenceGate_hpp